@@ -0,0 +1,215 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#ifndef Stilt_Fox_9d4b7e2a0c6f4183b5e8a1d3c7f0b926
+#define Stilt_Fox_9d4b7e2a0c6f4183b5e8a1d3c7f0b926
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <future>
+#include <functional>
+#include <type_traits>
+#include <condition_variable>
+#include "DatabaseConnection.h++"
+
+namespace StiltFox::StorageShed
+{
+    /*******************************************************************************************************************
+     * This class runs the queries for a single connection on its own thread, so the thread that submits them never
+     * waits on the database. Submitted work is run one piece at a time, in the order it was submitted, so a query
+     * submitted after an update will see the update. Each submit returns a future that is filled in with the result
+     * once the work has run.
+     *
+     * The connection is a copy of the connection given to the constructor, and is connected straight away. One
+     * AsyncConnection only ever has one query running, so an application that wants several queries running at once
+     * should create several of them, one per connection it wants to use.
+     *
+     * When an AsyncConnection is destroyed it finishes all of the work that has already been submitted. Call cancel
+     * first to throw that work away instead.
+     ******************************************************************************************************************/
+    template <typename Connection>
+    class AsyncConnection
+    {
+        // each task is either run with the connection, or told that it was cancelled
+        typedef std::function<void(Connection*)> Task;
+
+        Connection connection;
+        bool connected;
+        std::deque<Task> queue;
+        bool running = false, stopping = false;
+        // the number of cancel calls that are still interrupting the running task
+        size_t interrupting = 0;
+        std::mutex mutex;
+        std::condition_variable stateChanged;
+        std::thread worker;
+
+        void work()
+        {
+            std::unique_lock lock(mutex);
+
+            while (true)
+            {
+                // an interrupt that is still on its way would stop the next task too, so it has to land first
+                stateChanged.wait(lock, [this]() { return interrupting == 0 && (stopping || !queue.empty()); });
+                if (queue.empty()) break;
+
+                Task task = std::move(queue.front());
+                queue.pop_front();
+                running = true;
+                connection.clearInterrupt();
+                lock.unlock();
+                task(&connection);
+                lock.lock();
+                running = false;
+            }
+        }
+
+        public:
+        inline static const std::string cancelledError = "the query was cancelled before it was run";
+
+        /***************************************************************************************************************
+         * @param prototype - the connection to copy. It is not used by the AsyncConnection after it is copied.
+         **************************************************************************************************************/
+        AsyncConnection(const Connection& prototype) : connection(prototype)
+        {
+            connected = connection.connect();
+            worker = std::thread(&AsyncConnection::work, this);
+        }
+
+        AsyncConnection(const AsyncConnection&) = delete;
+        AsyncConnection& operator=(const AsyncConnection&) = delete;
+
+        ~AsyncConnection()
+        {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            stateChanged.notify_one();
+            worker.join();
+        }
+
+        /***************************************************************************************************************
+         * This function queues a piece of work to run on the connection. It is how functions without an Async version
+         * below, like starting a transaction, are run.
+         *
+         * @param work - this is called with the connection on the worker thread. It must return a Result, and must not
+         *               disconnect the connection.
+         *
+         * @return the future result of the work. If the work is cancelled before it runs, the result has
+         *         cancelledError as its error text. If the work throws, the exception is rethrown by get().
+         **************************************************************************************************************/
+        template <typename Work>
+        std::future<std::invoke_result_t<Work, Connection&>> submit(Work work)
+        {
+            typedef std::invoke_result_t<Work, Connection&> ResultType;
+            auto promise = std::make_shared<std::promise<ResultType>>();
+            std::future<ResultType> output = promise->get_future();
+
+            {
+                std::lock_guard lock(mutex);
+                queue.emplace_back([promise, work = std::move(work), wasConnected = connected](Connection* connection)
+                {
+                    if (connection != nullptr)
+                    {
+                        try
+                        {
+                            promise->set_value(work(*connection));
+                        }
+                        catch (...)
+                        {
+                            promise->set_exception(std::current_exception());
+                        }
+                    }
+                    else
+                    {
+                        ResultType cancelled = {};
+                        cancelled.connected = wasConnected;
+                        cancelled.errorText = cancelledError;
+                        promise->set_value(std::move(cancelled));
+                    }
+                });
+            }
+            stateChanged.notify_one();
+
+            return output;
+        }
+
+        std::future<Data::Result<Data::QueryReturnData>> performQueryAsync(const Data::StructuredQuery& query)
+        {
+            return submit([query](Connection& connection) { return connection.performQuery(query); });
+        }
+
+        std::future<Data::Result<Data::ResultTable>> performTableQueryAsync(const Data::StructuredQuery& query)
+        {
+            return submit([query](Connection& connection) { return connection.performTableQuery(query); });
+        }
+
+        std::future<Data::Result<void*>> performUpdateAsync(const Data::StructuredQuery& statement)
+        {
+            return submit([statement](Connection& connection) { return connection.performUpdate(statement); });
+        }
+
+        std::future<Data::Result<void*>> executeBatchAsync(const std::string& query,
+            const std::vector<Data::ParameterRow>& parameterRows)
+        {
+            return submit([query, parameterRows](Connection& connection)
+            {
+                return connection.executeBatch(query, parameterRows);
+            });
+        }
+
+        /***************************************************************************************************************
+         * This function throws away all of the work that has not started yet, and interrupts the work that is running.
+         * Every query the running work makes from then on is stopped too, so work that has been picked up by the
+         * worker but has not reached the database yet does not slip through.
+         *
+         * @return the number of pieces of work that were thrown away, not counting the interrupted one.
+         **************************************************************************************************************/
+        size_t cancel()
+        {
+            std::deque<Task> cancelled;
+            bool interruptRunning;
+
+            {
+                std::lock_guard lock(mutex);
+                cancelled.swap(queue);
+                interruptRunning = running;
+                if (interruptRunning) interrupting++;
+            }
+
+            // Interrupting can be slow, MariaDB has to open a second connection to kill the query, so it is done
+            // without the lock to keep submit from waiting on it. The worker will not start another task until it is
+            // done, so only the task that was running when cancel was called is interrupted.
+            if (interruptRunning)
+            {
+                connection.interrupt();
+                {
+                    std::lock_guard lock(mutex);
+                    interrupting--;
+                }
+                stateChanged.notify_one();
+            }
+            for (Task& task : cancelled) task(nullptr);
+
+            return cancelled.size();
+        }
+
+        /***************************************************************************************************************
+         * @return the number of pieces of work that have been submitted but not started.
+         **************************************************************************************************************/
+        size_t getPendingCount()
+        {
+            std::lock_guard lock(mutex);
+            return queue.size();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,445 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#ifndef Stilt_Fox_c52e9a17d4b04f3e8a6d1f0b7e3c9a28
+#define Stilt_Fox_c52e9a17d4b04f3e8a6d1f0b7e3c9a28
+#include <chrono>
+#include <memory>
+#include <algorithm>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace StiltFox::StorageShed
+{
+    namespace Data
+    {
+        /***************************************************************************************************************
+         * This class holds the counters for a ConnectionPool. Wait times include the time spent waiting for a free
+         * connection, but not the time spent opening a new one.
+         **************************************************************************************************************/
+        struct ConnectionPoolStatistics
+        {
+            // the number of leases that were handed out
+            size_t acquisitions = 0;
+            // the number of times a caller gave up waiting for a connection
+            size_t timeouts = 0;
+            // the number of connections the pool has opened
+            size_t connectionsOpened = 0;
+            // the number of connections thrown away because they could not connect or were no longer connected
+            size_t connectionsDiscarded = 0;
+            // the number of connections currently owned by the pool, idle or in use
+            size_t size = 0;
+            // the number of connections currently leased out
+            size_t inUse = 0;
+            // the largest number of connections that were leased out at the same time
+            size_t peakInUse = 0;
+            // the sum of the time every caller spent waiting for a connection
+            std::chrono::nanoseconds totalWaitTime = std::chrono::nanoseconds::zero();
+            // the longest time a single caller spent waiting for a connection
+            std::chrono::nanoseconds maximumWaitTime = std::chrono::nanoseconds::zero();
+            // the average fraction of the maximum pool size that has been leased out since the pool was created
+            double utilization = 0;
+        };
+    }
+
+    /*******************************************************************************************************************
+     * This tells the pool what a lease is going to be used for. Write leases count towards the maximumWriters limit of
+     * the pool, read leases do not.
+     ******************************************************************************************************************/
+    enum class ConnectionAccess
+    {
+        Read,
+        Write
+    };
+
+    /*******************************************************************************************************************
+     * These are the settings for a ConnectionPool.
+     ******************************************************************************************************************/
+    template <typename Connection>
+    struct ConnectionPoolOptions
+    {
+        // the number of connections the pool keeps open. They are opened when the pool is created, and connections
+        // that are thrown away are replaced by the next acquire
+        size_t minimumSize = 1;
+        // the largest number of connections the pool will ever have open at once
+        size_t maximumSize = 8;
+        // how long acquire() waits for a free connection before giving up
+        std::chrono::milliseconds acquireTimeout = std::chrono::seconds(30);
+        // the largest number of write leases handed out at once. 0 means there is no limit
+        size_t maximumWriters = 0;
+        // run on every newly opened connection. Returning false throws the connection away
+        std::function<bool(Connection&)> onConnect;
+    };
+
+    /*******************************************************************************************************************
+     * This class keeps a set of open connections that can be shared between threads. Each connection is only ever
+     * leased to one thread at a time, so the connections themselves do not need to be thread safe.
+     *
+     * New connections are copies of the connection given to the constructor. Copying a connection copies its
+     * connection information, but not the connection itself, so the pool can be built from a connection string or a
+     * MariaDBConnection::ConnectionInformation directly.
+     *
+     * Leases give their connection back to the pool when they leave scope. Idle connections are checked with
+     * isConnected() before they are handed out again, and are reconnected if they have been closed. A lease should
+     * finish any transaction it starts before it is given back, and every lease must be given back before the pool is
+     * destroyed.
+     ******************************************************************************************************************/
+    template <typename Connection>
+    class ConnectionPool
+    {
+        public:
+        /***************************************************************************************************************
+         * This class is a connection checked out of the pool. An empty lease is returned when no connection could be
+         * handed out, so check it before use.
+         **************************************************************************************************************/
+        class Lease
+        {
+            friend class ConnectionPool;
+
+            ConnectionPool* pool = nullptr;
+            std::unique_ptr<Connection> connection;
+            bool writer = false;
+
+            Lease(ConnectionPool* pool, std::unique_ptr<Connection> connection, bool writer)
+            {
+                this->pool = pool;
+                this->connection = std::move(connection);
+                this->writer = writer;
+            }
+
+            public:
+            Lease() = default;
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            Lease(Lease&& toMove) noexcept
+            {
+                *this = std::move(toMove);
+            }
+
+            Lease& operator=(Lease&& toMove) noexcept
+            {
+                if (this != &toMove)
+                {
+                    release();
+                    pool = toMove.pool;
+                    connection = std::move(toMove.connection);
+                    writer = toMove.writer;
+                    toMove.pool = nullptr;
+                }
+                return *this;
+            }
+
+            Connection* operator->() const
+            {
+                return connection.get();
+            }
+
+            Connection& operator*() const
+            {
+                return *connection;
+            }
+
+            explicit operator bool() const
+            {
+                return connection != nullptr;
+            }
+
+            /***********************************************************************************************************
+             * This function gives the connection back to the pool early. The lease is empty afterwards.
+             **********************************************************************************************************/
+            void release()
+            {
+                if (pool != nullptr) pool->giveBack(std::move(connection), writer);
+                pool = nullptr;
+            }
+
+            ~Lease()
+            {
+                release();
+            }
+        };
+
+        private:
+        Connection prototype;
+        ConnectionPoolOptions<Connection> options;
+        std::vector<std::unique_ptr<Connection>> idle;
+        size_t open = 0, inUse = 0, writers = 0;
+        std::mutex mutex;
+        std::condition_variable available;
+        Data::ConnectionPoolStatistics statistics;
+        std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now(), lastChange = created;
+        std::chrono::duration<double> busyTime = std::chrono::duration<double>::zero();
+
+        bool openConnection(Connection& connection)
+        {
+            bool output = connection.connect();
+
+            if (output && options.onConnect && !options.onConnect(connection))
+            {
+                connection.disconnect();
+                output = false;
+            }
+
+            return output;
+        }
+
+        // busy time is the number of leased connections integrated over time, it must be updated before inUse changes
+        void updateBusyTime()
+        {
+            const auto now = std::chrono::steady_clock::now();
+            busyTime += (double)inUse * (now - lastChange);
+            lastChange = now;
+        }
+
+        // This opens connections until the pool is back up to minimumSize, and must be called holding the lock. It
+        // stops at the first connection that can not be opened, so a database that is down is not retried over and
+        // over. It returns false if a connection could not be opened.
+        bool topUp(std::unique_lock<std::mutex>& lock)
+        {
+            bool output = true;
+
+            while (output && open < std::min(options.minimumSize, options.maximumSize))
+            {
+                // the slot is taken before connecting, so the lock does not have to be held while the connection opens
+                open++;
+                lock.unlock();
+                auto connection = std::make_unique<Connection>(prototype);
+                output = openConnection(*connection);
+                lock.lock();
+
+                if (output)
+                {
+                    idle.push_back(std::move(connection));
+                    statistics.connectionsOpened++;
+                    available.notify_all();
+                }
+                else
+                {
+                    open--;
+                    statistics.connectionsDiscarded++;
+                }
+            }
+
+            return output;
+        }
+
+        void giveBack(std::unique_ptr<Connection> connection, bool writer)
+        {
+            {
+                std::lock_guard lock(mutex);
+                updateBusyTime();
+                inUse--;
+                if (writer) writers--;
+
+                if (connection != nullptr && connection->isConnected())
+                {
+                    idle.push_back(std::move(connection));
+                }
+                else
+                {
+                    open--;
+                    statistics.connectionsDiscarded++;
+                }
+            }
+
+            available.notify_all();
+        }
+
+        public:
+        /***************************************************************************************************************
+         * @param prototype - the connection every pooled connection is copied from. It is never connected by the pool.
+         * @param options - the settings for this pool. minimumSize connections are opened straight away.
+         **************************************************************************************************************/
+        ConnectionPool(const Connection& prototype, const ConnectionPoolOptions<Connection>& options = {})
+            : prototype(prototype)
+        {
+            this->options = options;
+
+            for (size_t x=0; x<options.minimumSize && x<options.maximumSize; x++)
+            {
+                auto connection = std::make_unique<Connection>(prototype);
+                if (openConnection(*connection))
+                {
+                    idle.push_back(std::move(connection));
+                    open++;
+                    statistics.connectionsOpened++;
+                }
+                else
+                {
+                    statistics.connectionsDiscarded++;
+                }
+            }
+        }
+
+        ConnectionPool(const ConnectionPool&) = delete;
+        ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+        /***************************************************************************************************************
+         * This function waits up to the given amount of time for a connection. Idle connections are reused before new
+         * ones are opened. If connections were thrown away since the last call, the pool is first brought back up to
+         * minimumSize, so giving a lease back never has to wait for a connection to open.
+         *
+         * @param timeout - how long to wait for a free connection.
+         * @param access - Write leases will also wait until the pool is below its maximumWriters limit.
+         *
+         * @return a lease on a connected connection, or an empty lease if the wait timed out or a new connection could
+         *         not be opened.
+         **************************************************************************************************************/
+        Lease tryAcquire(std::chrono::milliseconds timeout, ConnectionAccess access = ConnectionAccess::Read)
+        {
+            const bool writer = access == ConnectionAccess::Write;
+            std::unique_ptr<Connection> connection;
+            std::unique_lock lock(mutex);
+
+            // if the pool could not be topped up there is no point opening another connection straight away
+            if (!topUp(lock) && idle.empty()) return {};
+            const auto start = std::chrono::steady_clock::now();
+
+            const bool ready = available.wait_until(lock, start + timeout, [this, writer]()
+            {
+                return (!idle.empty() || open < options.maximumSize) &&
+                    (!writer || options.maximumWriters == 0 || writers < options.maximumWriters);
+            });
+
+            const auto waited = std::chrono::steady_clock::now() - start;
+            statistics.totalWaitTime += waited;
+            statistics.maximumWaitTime = std::max(statistics.maximumWaitTime,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(waited));
+            if (!ready)
+            {
+                statistics.timeouts++;
+                return {};
+            }
+
+            updateBusyTime();
+            inUse++;
+            if (writer) writers++;
+            if (!idle.empty())
+            {
+                connection = std::move(idle.back());
+                idle.pop_back();
+            }
+            else
+            {
+                open++;
+            }
+            lock.unlock();
+
+            // connecting can be slow, so it is done without holding on to the lock
+            const bool stale = connection != nullptr && !connection->isConnected();
+            const bool reused = connection != nullptr && !stale;
+            bool connected = reused;
+            if (!reused)
+            {
+                if (stale) connection->disconnect();
+                else connection = std::make_unique<Connection>(prototype);
+                connected = openConnection(*connection);
+            }
+
+            lock.lock();
+            if (stale) statistics.connectionsDiscarded++;
+            if (!connected)
+            {
+                updateBusyTime();
+                inUse--;
+                open--;
+                if (writer) writers--;
+                if (!stale) statistics.connectionsDiscarded++;
+                lock.unlock();
+                available.notify_all();
+                return {};
+            }
+            if (!reused) statistics.connectionsOpened++;
+            statistics.acquisitions++;
+            statistics.peakInUse = std::max(statistics.peakInUse, inUse);
+
+            return Lease(this, std::move(connection), writer);
+        }
+
+        /***************************************************************************************************************
+         * This function is the same as tryAcquire, using the acquireTimeout from the pool options.
+         **************************************************************************************************************/
+        Lease acquire(ConnectionAccess access = ConnectionAccess::Read)
+        {
+            return tryAcquire(options.acquireTimeout, access);
+        }
+
+        /***************************************************************************************************************
+         * This function leases as many connections as it can, up to the given count, without waiting for any of them.
+         *
+         * @param count - the largest number of connections to lease.
+         * @param access - what the leases will be used for.
+         *
+         * @return the leases that could be handed out. This can be empty.
+         **************************************************************************************************************/
+        std::vector<Lease> acquireUpTo(size_t count, ConnectionAccess access = ConnectionAccess::Read)
+        {
+            std::vector<Lease> output;
+
+            for (size_t x=0; x<count; x++)
+            {
+                Lease lease = tryAcquire(std::chrono::milliseconds::zero(), access);
+                if (!lease) break;
+                output.emplace_back(std::move(lease));
+            }
+
+            return output;
+        }
+
+        /***************************************************************************************************************
+         * This function calls work once for every index from 0 up to count. The indexes are spread over the leased
+         * connections, with each lease being used by its own thread. It returns once all the work is done.
+         *
+         * @param leases - the connections to do the work on. Nothing is done if this is empty.
+         * @param count - the number of pieces of work to do.
+         * @param work - this is called with the connection to use and the index of the piece of work to do.
+         **************************************************************************************************************/
+        static void spreadWork(std::vector<Lease>& leases, size_t count,
+            const std::function<void(Connection&, size_t)>& work)
+        {
+            std::atomic<size_t> next = 0;
+            std::vector<std::thread> threads;
+
+            for (size_t x=1; x<leases.size(); x++)
+                threads.emplace_back([&lease = leases[x], &next, &work, count]()
+                {
+                    for (size_t index = next++; index < count; index = next++) work(*lease, index);
+                });
+            if (!leases.empty())
+                for (size_t index = next++; index < count; index = next++) work(*leases[0], index);
+
+            for (std::thread& thread : threads) thread.join();
+        }
+
+        const ConnectionPoolOptions<Connection>& getOptions() const
+        {
+            return options;
+        }
+
+        Data::ConnectionPoolStatistics getStatistics()
+        {
+            std::lock_guard lock(mutex);
+            updateBusyTime();
+
+            Data::ConnectionPoolStatistics output = statistics;
+            const std::chrono::duration<double> lifetime = lastChange - created;
+            output.size = open;
+            output.inUse = inUse;
+            if (lifetime.count() > 0 && options.maximumSize > 0)
+                output.utilization = busyTime / lifetime / (double)options.maximumSize;
+
+            return output;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -1,9 +1,20 @@
 #ifndef StiltFox_UniversalLibrary_DatabaseConnection
 #define StiltFox_UniversalLibrary_DatabaseConnection
+#include <array>
+#include <chrono>
+#include <cmath>
 #include <string>
+#include <cstdint>
+#include <optional>
+#include <cstdio>
+#include <charconv>
+#include <algorithm>
+#include <string_view>
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
+#include <variant>
+#include <functional>
 
 /***********************************************************************************************************************
  * This file contains the main interfaces that will be implemented for each supported database. These are designed to
@@ -53,6 +64,61 @@ namespace StiltFox::StorageShed
             return lhs.query == rhs.query && lhs.parameters == rhs.parameters;
         }
 
+        /***************************************************************************************************************
+         * This class marks a parameter as binary data rather than text.
+         **************************************************************************************************************/
+        struct Blob
+        {
+            std::string bytes;
+        };
+
+        /***************************************************************************************************************
+         * Unlike the parameters of a StructuredQuery, a Parameter keeps its native type when it is sent to the
+         * database. nullptr is bound as null, integers and doubles as numbers, strings as text and Blobs as binary.
+         **************************************************************************************************************/
+        typedef std::variant<std::nullptr_t, int64_t, double, std::string, Blob> Parameter;
+        typedef std::vector<Parameter> ParameterRow;
+
+        /***************************************************************************************************************
+         * This class holds the measurements of a single query when instrumentation is turned on. The time a query takes
+         * is split into phases:
+         * prepare - compiling the statement, or taking it from the statement cache, and binding its parameters.
+         * execute - running the statement up to the point where the first row, or the end of the results, is ready.
+         * fetch - reading every row after the first one from the database.
+         * materialize - copying each row into the returned data, or handing it to a visitor.
+         **************************************************************************************************************/
+        struct QueryMetrics
+        {
+            std::chrono::nanoseconds prepare = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds execute = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds fetch = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds materialize = std::chrono::nanoseconds::zero();
+            // the number of rows read
+            size_t rows = 0;
+            // the size of the values read. Text and binary values count their length, numbers count as 8 bytes.
+            size_t bytes = 0;
+
+            std::chrono::nanoseconds getTotal() const
+            {
+                return prepare + execute + fetch + materialize;
+            }
+
+            /***********************************************************************************************************
+             * This function adds the measurements of another query to these ones. It is used by operations that run
+             * more than one query.
+             **********************************************************************************************************/
+            QueryMetrics& operator+=(const QueryMetrics& toAdd)
+            {
+                prepare += toAdd.prepare;
+                execute += toAdd.execute;
+                fetch += toAdd.fetch;
+                materialize += toAdd.materialize;
+                rows += toAdd.rows;
+                bytes += toAdd.bytes;
+                return *this;
+            }
+        };
+
         /***************************************************************************************************************
          * In general, throwing exceptions in C++ is a bad idea. Because of this we need a way to communicate to the
          * caller that something went wrong. IO operations are prone to going wrong.
@@ -74,6 +140,98 @@ namespace StiltFox::StorageShed
             std::vector<StructuredQuery> performedQueries;
             // the actual returned data from the database action.
             T data;
+            // how long the operation took and how much it read. This is only filled in when instrumentation is turned
+            // on for the connection, and is not compared by the equals operator.
+            std::optional<QueryMetrics> metrics;
+        };
+
+        /***************************************************************************************************************
+         * This class holds the counters for a connection's prepared statement cache. Hits and misses are only counted
+         * while the cache is enabled.
+         **************************************************************************************************************/
+        struct StatementCacheStatistics
+        {
+            // the number of times a query was found in the cache and did not need to be prepared
+            size_t hits = 0;
+            // the number of times a query had to be prepared because it was not in the cache
+            size_t misses = 0;
+            // the number of statements thrown out of the cache to make room for newer ones
+            size_t evictions = 0;
+            // the number of statements currently in the cache
+            size_t size = 0;
+            // the maximum number of statements the cache will hold
+            size_t capacity = 0;
+        };
+
+        /***************************************************************************************************************
+         * this function overrides the equals operator for the StatementCacheStatistics object
+         **************************************************************************************************************/
+        inline bool operator==(const StatementCacheStatistics& lhs, const StatementCacheStatistics& rhs)
+        {
+            return lhs.hits == rhs.hits && lhs.misses == rhs.misses && lhs.evictions == rhs.evictions &&
+                lhs.size == rhs.size && lhs.capacity == rhs.capacity;
+        }
+
+        /***************************************************************************************************************
+         * This class counts how long a query took in buckets that grow exponentially, four buckets for every doubling
+         * of time. Percentiles are accurate to about 20% no matter how long the queries took, and the histogram always
+         * takes the same amount of memory.
+         **************************************************************************************************************/
+        class LatencyHistogram
+        {
+            static constexpr size_t bucketsPerDoubling = 4, bucketCount = 64 * bucketsPerDoubling;
+            std::array<uint64_t, bucketCount> buckets = {};
+            uint64_t count = 0;
+            std::chrono::nanoseconds total = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds minimum = std::chrono::nanoseconds::max();
+            std::chrono::nanoseconds maximum = std::chrono::nanoseconds::zero();
+
+            static size_t getBucket(std::chrono::nanoseconds latency)
+            {
+                const double nanoseconds = (double)std::max<int64_t>(latency.count(), 1);
+                return std::min(bucketCount - 1, (size_t)(std::log2(nanoseconds) * bucketsPerDoubling));
+            }
+
+            public:
+            void record(std::chrono::nanoseconds latency)
+            {
+                buckets[getBucket(latency)]++;
+                count++;
+                total += latency;
+                minimum = std::min(minimum, latency);
+                maximum = std::max(maximum, latency);
+            }
+
+            uint64_t getCount() const { return count; }
+            std::chrono::nanoseconds getTotal() const { return total; }
+            std::chrono::nanoseconds getMinimum() const { return count == 0 ? total : minimum; }
+            std::chrono::nanoseconds getMaximum() const { return maximum; }
+
+            /***********************************************************************************************************
+             * This function estimates the latency that the given fraction of queries finished within.
+             *
+             * @param percentile - a number between 0 and 1. 0.5 is the median, 0.99 is the 99th percentile.
+             *
+             * @return the upper edge of the bucket the percentile falls in, kept between the minimum and maximum
+             *         recorded latencies. This is 0 if nothing has been recorded.
+             **********************************************************************************************************/
+            std::chrono::nanoseconds getPercentile(double percentile) const
+            {
+                std::chrono::nanoseconds output = std::chrono::nanoseconds::zero();
+
+                if (count > 0)
+                {
+                    const uint64_t rank = std::max<uint64_t>(1, (uint64_t)std::ceil(percentile * (double)count));
+                    uint64_t seen = 0;
+                    size_t bucket = 0;
+                    while (bucket < bucketCount - 1 && (seen += buckets[bucket]) < rank) bucket++;
+
+                    const double upperEdge = std::exp2((double)(bucket + 1) / bucketsPerDoubling);
+                    output = std::clamp(std::chrono::nanoseconds((int64_t)upperEdge), minimum, maximum);
+                }
+
+                return output;
+            }
         };
 
         /***************************************************************************************************************
@@ -85,6 +243,322 @@ namespace StiltFox::StorageShed
             return lhs.errorText == rhs.errorText && lhs.connected == rhs.connected && lhs.data == rhs.data &&
                 lhs.performedQueries == rhs.performedQueries;
         }
+
+        /***************************************************************************************************************
+         * This is the type of a single value returned from the database.
+         **************************************************************************************************************/
+        enum class ValueType
+        {
+            Null,
+            Integer,
+            Real,
+            Text,
+            Blob
+        };
+
+        /***************************************************************************************************************
+         * This class is a compact alternative to QueryReturnData for queries that return a lot of rows. Column names
+         * are stored once for the whole table, numbers are stored as numbers, and all text and blob values share one
+         * growing buffer. This means that filling a ResultTable does not allocate anything per row or per value.
+         *
+         * Values are stored row by row and can be read either by row and column index, or through a RowView. Text and
+         * blob values are handed out as string_views into the table, so they are only valid as long as the table is
+         * alive and has not been added to.
+         *
+         * Use toQueryReturnData() if you need to hand the data to code that expects the older format.
+         **************************************************************************************************************/
+        class ResultTable
+        {
+            struct Cell
+            {
+                ValueType type = ValueType::Null;
+                // the length of the text a real was read from, 0 if it was read as a number
+                uint32_t realTextLength = 0;
+                union
+                {
+                    int64_t integer;
+                    struct
+                    {
+                        double value;
+                        size_t textOffset;
+                    } real;
+                    struct
+                    {
+                        size_t offset, length;
+                    } bytes;
+                };
+            };
+
+            std::vector<std::string> columnNames;
+            std::vector<Cell> cells;
+            std::string arena;
+
+            const Cell& getCell(size_t row, size_t column) const
+            {
+                return cells[row * columnNames.size() + column];
+            }
+
+            std::string_view getBytes(const Cell& cell) const
+            {
+                return (cell.type == ValueType::Text || cell.type == ValueType::Blob) ?
+                    std::string_view(arena).substr(cell.bytes.offset, cell.bytes.length) : std::string_view();
+            }
+
+            void appendBytes(ValueType type, std::string_view value)
+            {
+                Cell& cell = cells.emplace_back();
+                cell.type = type;
+                cell.bytes = {arena.size(), value.size()};
+                arena.append(value);
+            }
+
+            public:
+            /***********************************************************************************************************
+             * This class is a lightweight reference to a single row of a ResultTable. It is cheap to copy and does not
+             * own any data.
+             **********************************************************************************************************/
+            class RowView
+            {
+                const ResultTable* table;
+                size_t row;
+
+                public:
+                RowView(const ResultTable* table, size_t row) : table(table), row(row) {}
+
+                size_t getColumnCount() const { return table->getColumnCount(); }
+                const std::vector<std::string>& getColumnNames() const { return table->getColumnNames(); }
+                ValueType getType(size_t column) const { return table->getType(row, column); }
+                bool isNull(size_t column) const { return table->isNull(row, column); }
+                int64_t getInteger(size_t column) const { return table->getInteger(row, column); }
+                double getReal(size_t column) const { return table->getReal(row, column); }
+                std::string_view getText(size_t column) const { return table->getText(row, column); }
+                std::string_view getBlob(size_t column) const { return table->getBlob(row, column); }
+                std::string getString(size_t column) const { return table->getString(row, column); }
+            };
+
+            /***********************************************************************************************************
+             * This function sets the column names for the table. It should be called once before any values are added.
+             **********************************************************************************************************/
+            void setColumnNames(std::vector<std::string> columnNames)
+            {
+                this->columnNames = std::move(columnNames);
+            }
+
+            // These functions add the next value to the table, filling each row from left to right.
+            void appendNull() { cells.emplace_back(); }
+            void appendInteger(int64_t value)
+            {
+                cells.emplace_back().type = ValueType::Integer;
+                cells.back().integer = value;
+            }
+            void appendReal(double value)
+            {
+                cells.emplace_back().type = ValueType::Real;
+                cells.back().real = {value, 0};
+            }
+            // Databases that send numbers as text can keep that text, so getString gives back exactly what was read.
+            void appendReal(double value, std::string_view text)
+            {
+                Cell& cell = cells.emplace_back();
+                cell.type = ValueType::Real;
+                cell.realTextLength = (uint32_t)text.size();
+                cell.real = {value, arena.size()};
+                arena.append(text);
+            }
+            void appendText(std::string_view value) { appendBytes(ValueType::Text, value); }
+            void appendBlob(std::string_view value) { appendBytes(ValueType::Blob, value); }
+
+            /***********************************************************************************************************
+             * This function removes every row and column from the table, but keeps the memory that was allocated so the
+             * table can be refilled without allocating again.
+             **********************************************************************************************************/
+            void clear()
+            {
+                columnNames.clear();
+                cells.clear();
+                arena.clear();
+            }
+
+            /***********************************************************************************************************
+             * This function removes every row from the table but keeps the column names and the allocated memory. This
+             * is used to reuse one table while streaming rows.
+             **********************************************************************************************************/
+            void clearRows()
+            {
+                cells.clear();
+                arena.clear();
+            }
+
+            size_t getRowCount() const
+            {
+                return columnNames.empty() ? 0 : cells.size() / columnNames.size();
+            }
+
+            size_t getColumnCount() const
+            {
+                return columnNames.size();
+            }
+
+            const std::vector<std::string>& getColumnNames() const
+            {
+                return columnNames;
+            }
+
+            /***********************************************************************************************************
+             * This function finds the index of a column by name.
+             *
+             * @return the index of the column, or getColumnCount() if there is no column with that name.
+             **********************************************************************************************************/
+            size_t findColumn(std::string_view name) const
+            {
+                size_t output = 0;
+                while (output < columnNames.size() && columnNames[output] != name) output++;
+                return output;
+            }
+
+            ValueType getType(size_t row, size_t column) const
+            {
+                return getCell(row, column).type;
+            }
+
+            bool isNull(size_t row, size_t column) const
+            {
+                return getCell(row, column).type == ValueType::Null;
+            }
+
+            /***********************************************************************************************************
+             * This function reads a value as an integer. Reals are truncated, text is parsed, and null or unparsable
+             * values are returned as 0.
+             **********************************************************************************************************/
+            int64_t getInteger(size_t row, size_t column) const
+            {
+                const Cell& cell = getCell(row, column);
+                int64_t output = 0;
+
+                if (cell.type == ValueType::Integer) output = cell.integer;
+                else if (cell.type == ValueType::Real) output = (int64_t)cell.real.value;
+                else if (cell.type == ValueType::Text)
+                {
+                    const std::string_view text = getBytes(cell);
+                    std::from_chars(text.data(), text.data() + text.size(), output);
+                }
+
+                return output;
+            }
+
+            /***********************************************************************************************************
+             * This function reads a value as a double. Integers are converted, text is parsed, and null or unparsable
+             * values are returned as 0.
+             **********************************************************************************************************/
+            double getReal(size_t row, size_t column) const
+            {
+                const Cell& cell = getCell(row, column);
+                double output = 0;
+
+                if (cell.type == ValueType::Real) output = cell.real.value;
+                else if (cell.type == ValueType::Integer) output = (double)cell.integer;
+                else if (cell.type == ValueType::Text)
+                {
+                    const std::string_view text = getBytes(cell);
+                    std::from_chars(text.data(), text.data() + text.size(), output);
+                }
+
+                return output;
+            }
+
+            /***********************************************************************************************************
+             * These functions give a view of a text or blob value without copying it. Numbers and nulls return an empty
+             * view, use getString() if you want any value as text.
+             **********************************************************************************************************/
+            std::string_view getText(size_t row, size_t column) const
+            {
+                return getBytes(getCell(row, column));
+            }
+
+            std::string_view getBlob(size_t row, size_t column) const
+            {
+                return getBytes(getCell(row, column));
+            }
+
+            /***********************************************************************************************************
+             * This function copies any value into a string. Nulls become an empty string. Reals that were added with
+             * their text are given back as that text, the rest are written with 15 significant digits and always have a
+             * decimal point, the same way sqlite writes them as text.
+             **********************************************************************************************************/
+            std::string getString(size_t row, size_t column) const
+            {
+                const Cell& cell = getCell(row, column);
+                std::string output;
+
+                if (cell.type == ValueType::Integer)
+                {
+                    output = std::to_string(cell.integer);
+                }
+                else if (cell.type == ValueType::Real && cell.realTextLength > 0)
+                {
+                    output = std::string_view(arena).substr(cell.real.textOffset, cell.realTextLength);
+                }
+                else if (cell.type == ValueType::Real)
+                {
+                    char buffer[32];
+                    output.assign(buffer, std::snprintf(buffer, sizeof(buffer), "%.15g", cell.real.value));
+                    if (output.find_first_of(".ni") == std::string::npos)
+                        output.insert(std::min(output.find('e'), output.size()), ".0");
+                }
+                else
+                {
+                    output = getBytes(cell);
+                }
+
+                return output;
+            }
+
+            RowView operator[](size_t row) const
+            {
+                return {this, row};
+            }
+
+            /***********************************************************************************************************
+             * This function converts the table into the row of maps format used by performQuery.
+             **********************************************************************************************************/
+            QueryReturnData toQueryReturnData() const
+            {
+                QueryReturnData output;
+                output.reserve(getRowCount());
+
+                for (size_t row = 0; row < getRowCount(); row++)
+                {
+                    Row& currentRow = output.emplace_back();
+                    for (size_t column = 0; column < columnNames.size(); column++)
+                        currentRow[columnNames[column]] = getString(row, column);
+                }
+
+                return output;
+            }
+
+            /***********************************************************************************************************
+             * This function overrides the equals operator for ResultTable. Two tables are equal if they have the same
+             * columns and every value has the same type and contents.
+             **********************************************************************************************************/
+            friend bool operator==(const ResultTable& lhs, const ResultTable& rhs)
+            {
+                bool output = lhs.columnNames == rhs.columnNames && lhs.cells.size() == rhs.cells.size();
+
+                for (size_t x = 0; output && x < lhs.cells.size(); x++)
+                {
+                    const Cell& left = lhs.cells[x];
+                    const Cell& right = rhs.cells[x];
+
+                    output = left.type == right.type;
+                    if (output && left.type == ValueType::Integer) output = left.integer == right.integer;
+                    if (output && left.type == ValueType::Real) output = left.real.value == right.real.value;
+                    if (output && (left.type == ValueType::Text || left.type == ValueType::Blob))
+                        output = lhs.getBytes(left) == rhs.getBytes(right);
+                }
+
+                return output;
+            }
+        };
     }
 
     /*******************************************************************************************************************
@@ -148,6 +622,24 @@ namespace StiltFox::StorageShed
          *         will return valid information, however data will remain unused. Hence, the void typing.
          **************************************************************************************************************/
         virtual Data::Result<void*> performUpdate(const Data::StructuredQuery& statement) = 0;
+        /***************************************************************************************************************
+         * This function will execute the same statement once for every row of parameters. The statement is prepared
+         * once and the whole batch is sent in a single transaction, which makes this much faster than calling
+         * performUpdate in a loop when loading a lot of data.
+         *
+         * If no transaction is open, one will be started for the batch and committed at the end. If any row fails the
+         * whole batch is rolled back. If a transaction is already open, it is left for the caller to commit or roll
+         * back.
+         *
+         * @param query - a statement with ? marks where the parameters are supposed to go.
+         * @param parameterRows - one row of parameters for each time the statement should run. Rows with too few
+         *                        parameters are filled in with nulls and extra parameters are ignored.
+         *
+         * @return this will return a Result object of the void type. rowsEffected will hold the total number of
+         *         records changed by the whole batch.
+         **************************************************************************************************************/
+        virtual Data::Result<void*> executeBatch(const std::string& query,
+            const std::vector<Data::ParameterRow>& parameterRows) = 0;
         /***************************************************************************************************************
          * This function will validate the structure of the database against a provided set of table definitions.
          * Depending on weather strict is set or not, it will change how it's evaluation is done. If strict is set
@@ -161,8 +653,12 @@ namespace StiltFox::StorageShed
          * @return this will return a set of strings that indicate each error found. It will be a list of differences
          *         between the database and requested structure. If this list is empty, it means that validation was
          *         passed. These are designed to be human-readable for error messages or logging.
+         *
+         * The structure of the database is cached by the connection, and is only read again once the database reports
+         * that it has changed. Validating the same connection over and over again is cheap.
          **************************************************************************************************************/
-        virtual std::unordered_set<std::string> validate(Data::TableDefinitions tableDefinitions, bool strict) = 0;
+        virtual std::unordered_set<std::string> validate(const Data::TableDefinitions& tableDefinitions,
+            bool strict) = 0;
         /***************************************************************************************************************
          * This function will get the metadata of the database. That means a list of every table, each column in that
          * table and it's type.
@@ -171,6 +667,17 @@ namespace StiltFox::StorageShed
          *         the database is not connected.
          **************************************************************************************************************/
         virtual Data::Result<Data::TableDefinitions> getMetaData() = 0;
+        /***************************************************************************************************************
+         * This function does the same thing as getMetaData, but can spread the work over several connections of its
+         * own. Databases that can read the whole structure in one query may ignore the number of workers and read it
+         * serially on this connection, check the connection class before relying on this being parallel.
+         *
+         * @param workers - the largest number of connections to read with at the same time. 0 or 1 is the same as
+         *                  calling getMetaData().
+         *
+         * @return the same result getMetaData() would return.
+         **************************************************************************************************************/
+        virtual Data::Result<Data::TableDefinitions> getMetaData(size_t workers) = 0;
         /***************************************************************************************************************
          * This function will perform a query that returns a result. This is usually used for select or show
          * statements.
@@ -192,14 +699,84 @@ namespace StiltFox::StorageShed
          *         should be considered invalid.
          **************************************************************************************************************/
         virtual Data::Result<Data::QueryReturnData> performQuery(Data::StructuredQuery query) = 0;
+        /***************************************************************************************************************
+         * This function will perform a query that returns a result, just like performQuery. The difference is that
+         * the rows are returned in a ResultTable, which keeps each value in its native type and avoids allocating a
+         * map and a set of strings for every row. Prefer this for queries that return a large number of rows.
+         *
+         * @param query - this is the query that you wish to execute.
+         *
+         * @return this will return a result of the ResultTable type. If success is set to false the data returned
+         *         should be considered invalid.
+         **************************************************************************************************************/
+        virtual Data::Result<Data::ResultTable> performTableQuery(std::string query) = 0;
+        /***************************************************************************************************************
+         * This function will perform a query that returns a result, just like performQuery. The difference is that
+         * the rows are returned in a ResultTable, which keeps each value in its native type and avoids allocating a
+         * map and a set of strings for every row. Prefer this for queries that return a large number of rows.
+         *
+         * @param query - a structured query that represents the statement you'd like to execute. See the structured
+         *                query class above for details.
+         *
+         * @return this will return a result of the ResultTable type. If success is set to false the data returned
+         *         should be considered invalid.
+         **************************************************************************************************************/
+        virtual Data::Result<Data::ResultTable> performTableQuery(const Data::StructuredQuery& query) = 0;
         /***************************************************************************************************************
          * This function will return all data stored in the database. This can be slow and memory consuming on larger
-         * databases. It is recommended to only use this for testing purposes.
+         * databases. It is recommended to only use this for testing purposes, see streamAllData for a version that
+         * does not hold the whole database in memory.
          *
          * @return a result object holding all data stored in the database, sorted by table. This will fail if the
          *         database is not connected.
          **************************************************************************************************************/
         virtual Data::Result<Data::MultiTableData> getAllData() = 0;
+        /***************************************************************************************************************
+         * This function does the same thing as getAllData, but reads the tables in parallel. Each worker is a separate
+         * read only connection that reads a share of the tables inside its own read transaction, so no table is read
+         * half way through a change. Whether every worker shares exactly the same snapshot depends on the database,
+         * see the connection class for details. Other connections may have to wait to write while the snapshots are
+         * being opened.
+         *
+         * The database will fall back to reading the tables one at a time on this connection if it can not take a
+         * snapshot, for example when this connection is in the middle of a transaction.
+         *
+         * @param workers - the largest number of connections to read with at the same time. 0 or 1 is the same as
+         *                  calling getAllData().
+         *
+         * @return the same result getAllData() would return, including the order of performedQueries.
+         **************************************************************************************************************/
+        virtual Data::Result<Data::MultiTableData> getAllData(size_t workers) = 0;
+        /***************************************************************************************************************
+         * This function will perform a query and hand each row to the visitor as soon as it is read, instead of
+         * collecting the whole result first. Memory use stays the same no matter how many rows the query returns.
+         *
+         * The row passed to the visitor is only valid during that call. Do not run other queries on this connection
+         * from inside the visitor, some databases can not do anything else until the rows have all been read.
+         *
+         * @param query - a structured query that represents the statement you'd like to execute. See the structured
+         *                query class above for details.
+         * @param visitor - this is called once for each row. Return false to stop reading rows early.
+         *
+         * @return this will return a Result object of the void type. If success is set to false the rows that were
+         *         visited should be considered incomplete.
+         **************************************************************************************************************/
+        virtual Data::Result<void*> streamQuery(const Data::StructuredQuery& query,
+            const std::function<bool(const Data::ResultTable::RowView&)>& visitor) = 0;
+        /***************************************************************************************************************
+         * This function will read every table in the database and hand the rows to the sink in batches, one table at
+         * a time. Only one batch is held in memory at once, so this can be used to export databases of any size.
+         *
+         * @param sink - this is called with the table name and up to batchSize rows at a time. It is called at least
+         *               once for every table, with an empty batch if the table has no rows. Return false to stop.
+         * @param batchSize - the maximum number of rows handed to the sink in one call.
+         *
+         * @return a result holding the queries that were performed, and any errors that occurred. The data is not
+         *         used. This will fail if the database is not connected.
+         **************************************************************************************************************/
+        virtual Data::Result<void*> streamAllData(
+            const std::function<bool(const std::string& table, const Data::ResultTable& rows)>& sink,
+            size_t batchSize = 1000) = 0;
         /***************************************************************************************************************
          * This function simply returns weather or not we are currently connected to the database.
          *
@@ -213,6 +790,63 @@ namespace StiltFox::StorageShed
          * @return the connection string for the database.
          **************************************************************************************************************/
         virtual std::string getConnectionString() = 0;
+        /***************************************************************************************************************
+         * Connections keep a small cache of prepared statements keyed by query text, so running the same query again
+         * skips parsing and planning. This function changes how many statements are kept. Setting this to 0 will
+         * disable the cache.
+         *
+         * @param size - the maximum number of prepared statements to keep.
+         **************************************************************************************************************/
+        virtual void setStatementCacheSize(size_t size) = 0;
+        /***************************************************************************************************************
+         * This function throws away every cached prepared statement. The cache is also cleared on disconnect and after
+         * any statement that changes the structure of the database.
+         **************************************************************************************************************/
+        virtual void clearStatementCache() = 0;
+        /***************************************************************************************************************
+         * This function gets the hit and miss counters of the prepared statement cache.
+         *
+         * @return the current statistics for this connection's statement cache.
+         **************************************************************************************************************/
+        virtual Data::StatementCacheStatistics getStatementCacheStatistics() = 0;
+        /***************************************************************************************************************
+         * This function turns on instrumentation for this connection. Every query that is run afterwards will have its
+         * metrics filled in on the result it returns, and its total time recorded in a histogram for its query text.
+         * While instrumentation is off, the only cost is checking whether it is on.
+         *
+         * @param slowQueryThreshold - queries that take at least this long are passed to onSlowQuery.
+         * @param onSlowQuery - this is called on the thread that ran the query, right after it finishes.
+         **************************************************************************************************************/
+        virtual void enableInstrumentation(
+            std::chrono::nanoseconds slowQueryThreshold = std::chrono::nanoseconds::max(),
+            const std::function<void(const Data::StructuredQuery&, const Data::QueryMetrics&)>& onSlowQuery = {}) = 0;
+        /***************************************************************************************************************
+         * This function turns instrumentation off. Histograms that have already been recorded are kept.
+         **************************************************************************************************************/
+        virtual void disableInstrumentation() = 0;
+        /***************************************************************************************************************
+         * This function gets the latency histograms recorded while instrumentation was on.
+         *
+         * @return a histogram of the total query time for each query text that has been run.
+         **************************************************************************************************************/
+        virtual std::unordered_map<std::string, Data::LatencyHistogram> getLatencyHistograms() = 0;
+        /***************************************************************************************************************
+         * This function throws away every recorded latency histogram.
+         **************************************************************************************************************/
+        virtual void clearLatencyHistograms() = 0;
+        /***************************************************************************************************************
+         * This function stops the query this connection is running as soon as it can. Every query started after it is
+         * called is stopped as well until clearInterrupt is called, so a query that was just about to start when the
+         * interrupt arrived is not missed. Stopped queries return an error.
+         *
+         * Unlike every other function on a connection, this one may be called from another thread while a query is
+         * running. It must not be called while the connection is being opened or closed.
+         **************************************************************************************************************/
+        virtual void interrupt() = 0;
+        /***************************************************************************************************************
+         * This function lets queries run again after interrupt was called. Nothing happens if interrupt was not called.
+         **************************************************************************************************************/
+        virtual void clearInterrupt() = 0;
     };
 }
 
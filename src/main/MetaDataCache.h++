@@ -0,0 +1,119 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#ifndef Stilt_Fox_3b8e1f6a4d0c4a95b7e2c9d5f1a0b368
+#define Stilt_Fox_3b8e1f6a4d0c4a95b7e2c9d5f1a0b368
+#include <string>
+#include <unordered_set>
+#include "DatabaseConnection.h++"
+
+namespace StiltFox::StorageShed
+{
+    /*******************************************************************************************************************
+     * This function compares the structure a database is expected to have with the structure it really has. It is the
+     * comparison used by every validate implementation, so they all report differences the same way.
+     *
+     * @param expected - the tables and columns that should be in the database.
+     * @param actual - the tables and columns that are in the database.
+     * @param strict - if this is true, tables and columns that are in the database but not expected are reported too.
+     *
+     * @return a human readable message for each difference. This is empty if the structures match.
+     ******************************************************************************************************************/
+    inline std::unordered_set<std::string> compareTableDefinitions(const Data::TableDefinitions& expected,
+        const Data::TableDefinitions& actual, bool strict)
+    {
+        std::unordered_set<std::string> output;
+
+        if (strict)
+        {
+            for (auto const&[tableName, columnData] : actual)
+            {
+                const auto expectedTable = expected.find(tableName);
+
+                if (expectedTable != expected.end())
+                {
+                    for (auto const&[columnName, columnType] : columnData)
+                    {
+                        if (!expectedTable->second.contains(columnName))
+                            output.emplace("Unwanted column " + columnName + " in table " + tableName);
+                    }
+                }
+                else
+                {
+                    output.emplace("Unwanted table " + tableName);
+                }
+            }
+        }
+
+        for (auto const&[tableName, columnData] : expected)
+        {
+            const auto actualTable = actual.find(tableName);
+
+            if (actualTable != actual.end())
+            {
+                for (auto const&[columnName, columnType] : columnData)
+                {
+                    const auto actualColumn = actualTable->second.find(columnName);
+
+                    if (actualColumn != actualTable->second.end())
+                    {
+                        if (actualColumn->second != columnType)
+                            output.emplace("Column " + columnName + " in table " + tableName +
+                                " is the wrong type; expected: " + columnType + " actual: " + actualColumn->second);
+                    }
+                    else
+                    {
+                        output.emplace("Missing column in " + tableName + ": " + columnName);
+                    }
+                }
+            }
+            else
+            {
+                output.emplace("Missing table " + tableName);
+            }
+        }
+
+        return output;
+    }
+
+    /*******************************************************************************************************************
+     * This class holds the structure of a database along with a version that tells the connection whether it is still
+     * current. What the version is depends on the database; it only has to change whenever the structure does.
+     ******************************************************************************************************************/
+    class MetaDataCache
+    {
+        bool valid = false;
+        std::string version;
+        Data::TableDefinitions definitions;
+
+        public:
+        bool isCurrent(const std::string& version) const
+        {
+            return valid && this->version == version;
+        }
+
+        void store(const std::string& version, Data::TableDefinitions definitions)
+        {
+            this->version = version;
+            this->definitions = std::move(definitions);
+            valid = true;
+        }
+
+        void invalidate()
+        {
+            valid = false;
+            definitions.clear();
+        }
+
+        const Data::TableDefinitions& getDefinitions() const
+        {
+            return definitions;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
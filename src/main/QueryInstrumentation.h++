@@ -0,0 +1,110 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#ifndef Stilt_Fox_f1a83c6e0b2d4e97a5c4d8b1e6f0a372
+#define Stilt_Fox_f1a83c6e0b2d4e97a5c4d8b1e6f0a372
+#include <chrono>
+#include <string>
+#include <functional>
+#include <unordered_map>
+#include "DatabaseConnection.h++"
+
+namespace StiltFox::StorageShed
+{
+    /*******************************************************************************************************************
+     * This class measures the phases of a single query. Each call to lap adds the time since the last lap to the given
+     * phase. When the timer is disabled it never reads the clock.
+     ******************************************************************************************************************/
+    class QueryTimer
+    {
+        bool enabled;
+        std::chrono::steady_clock::time_point last;
+
+        public:
+        explicit QueryTimer(bool enabled)
+        {
+            this->enabled = enabled;
+            if (enabled) last = std::chrono::steady_clock::now();
+        }
+
+        void lap(std::chrono::nanoseconds& phase)
+        {
+            if (enabled)
+            {
+                const auto now = std::chrono::steady_clock::now();
+                phase += now - last;
+                last = now;
+            }
+        }
+    };
+
+    /*******************************************************************************************************************
+     * This class holds the instrumentation settings and latency histograms for a connection. Like the connection
+     * itself, it is not thread safe.
+     *
+     * Histograms are kept for the first maximumHistograms query texts that are seen. Queries after that still get
+     * metrics and slow query callbacks, but are not added to a histogram. This keeps queries that have values written
+     * into their text from growing the map forever.
+     ******************************************************************************************************************/
+    class QueryInstrumentation
+    {
+        bool enabled = false;
+        std::chrono::nanoseconds slowQueryThreshold = std::chrono::nanoseconds::max();
+        std::function<void(const Data::StructuredQuery&, const Data::QueryMetrics&)> onSlowQuery;
+        std::unordered_map<std::string, Data::LatencyHistogram> histograms;
+
+        public:
+        static constexpr size_t maximumHistograms = 1000;
+
+        bool isEnabled() const
+        {
+            return enabled;
+        }
+
+        void enable(std::chrono::nanoseconds slowQueryThreshold,
+            const std::function<void(const Data::StructuredQuery&, const Data::QueryMetrics&)>& onSlowQuery)
+        {
+            enabled = true;
+            this->slowQueryThreshold = slowQueryThreshold;
+            this->onSlowQuery = onSlowQuery;
+        }
+
+        void disable()
+        {
+            enabled = false;
+        }
+
+        /***************************************************************************************************************
+         * This function adds a finished query to the histogram for its text, and passes it to the slow query callback
+         * if it took long enough.
+         **************************************************************************************************************/
+        void record(const Data::StructuredQuery& query, const Data::QueryMetrics& metrics)
+        {
+            const std::chrono::nanoseconds total = metrics.getTotal();
+            auto found = histograms.find(query.query);
+
+            if (found != histograms.end())
+                found->second.record(total);
+            else if (histograms.size() < maximumHistograms)
+                histograms[query.query].record(total);
+
+            if (onSlowQuery && total >= slowQueryThreshold) onSlowQuery(query, metrics);
+        }
+
+        const std::unordered_map<std::string, Data::LatencyHistogram>& getHistograms() const
+        {
+            return histograms;
+        }
+
+        void clearHistograms()
+        {
+            histograms.clear();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
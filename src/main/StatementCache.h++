@@ -0,0 +1,204 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#ifndef Stilt_Fox_3b1d6f0e2c5a4e7b9d8f1a2c4e6b8d0f
+#define Stilt_Fox_3b1d6f0e2c5a4e7b9d8f1a2c4e6b8d0f
+#include <list>
+#include <string>
+#include <cctype>
+#include <functional>
+#include <unordered_map>
+#include "DatabaseConnection.h++"
+
+namespace StiltFox::StorageShed
+{
+    /*******************************************************************************************************************
+     * This function reads the first word of a query in lower case, skipping any leading whitespace.
+     *
+     * @param query - the sql statement to read.
+     *
+     * @return the first keyword of the statement, or an empty string if it does not start with a word.
+     ******************************************************************************************************************/
+    inline std::string getFirstKeyword(const std::string& query)
+    {
+        size_t start = 0;
+        while (start < query.size() && std::isspace((unsigned char)query[start])) start++;
+        size_t end = start;
+        while (end < query.size() && std::isalpha((unsigned char)query[end])) end++;
+
+        std::string keyword = query.substr(start, end - start);
+        for (char& character : keyword) character = (char)std::tolower((unsigned char)character);
+
+        return keyword;
+    }
+
+    /*******************************************************************************************************************
+     * This function checks if a query will change the structure of the database. Prepared statements can hold on to
+     * the structure of the tables they were compiled against, so any cache of them should be thrown away when one of
+     * these statements runs.
+     *
+     * @param query - the sql statement to check.
+     *
+     * @return true if the statement starts with create, drop, alter, rename or truncate.
+     ******************************************************************************************************************/
+    inline bool isSchemaChange(const std::string& query)
+    {
+        const std::string keyword = getFirstKeyword(query);
+
+        return keyword == "create" || keyword == "drop" || keyword == "alter" || keyword == "rename" ||
+            keyword == "truncate";
+    }
+
+    /*******************************************************************************************************************
+     * This function checks if a query rolls back a transaction. A rollback can undo changes to the structure without
+     * running any of the statements above, so a cached copy of the structure should be thrown away when one runs.
+     *
+     * @param query - the sql statement to check.
+     *
+     * @return true if the statement starts with rollback.
+     ******************************************************************************************************************/
+    inline bool isRollback(const std::string& query)
+    {
+        return getFirstKeyword(query) == "rollback";
+    }
+
+    /*******************************************************************************************************************
+     * This class is a bounded, least recently used cache of prepared statements keyed by their query text. It is used
+     * by the connection classes to avoid parsing and planning the same sql over and over again.
+     *
+     * Statements are taken out of the cache while they are in use and given back when the caller is done with them.
+     * This means a statement can never be handed out twice at the same time, even if a query is run from inside of
+     * another query's loop. The cache owns every statement it holds and will finalize them using the function provided
+     * in the constructor.
+     *
+     * This class is not thread safe. It is meant to live inside a single connection.
+     ******************************************************************************************************************/
+    template <typename Statement>
+    class StatementCache
+    {
+        typedef std::pair<std::string, Statement> Entry;
+
+        std::list<Entry> entries;
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> index;
+        std::function<void(Statement)> finalize;
+        size_t capacity;
+        Data::StatementCacheStatistics statistics;
+
+        void evictDownTo(size_t size)
+        {
+            while (entries.size() > size)
+            {
+                finalize(entries.back().second);
+                index.erase(entries.back().first);
+                entries.pop_back();
+                statistics.evictions++;
+            }
+        }
+
+        public:
+        /***************************************************************************************************************
+         * @param finalize - the function used to release a statement when it is evicted or the cache is cleared.
+         * @param capacity - the maximum number of statements to hold on to. A capacity of 0 disables the cache.
+         **************************************************************************************************************/
+        StatementCache(std::function<void(Statement)> finalize, size_t capacity = 64)
+        {
+            this->finalize = finalize;
+            this->capacity = capacity;
+        }
+
+        StatementCache(const StatementCache&) = delete;
+        StatementCache& operator=(const StatementCache&) = delete;
+
+        /***************************************************************************************************************
+         * This function removes a statement from the cache so that it can be used. The statement should be given back
+         * using give() once the caller is done with it.
+         *
+         * @param query - the query text the statement was prepared from.
+         *
+         * @return the cached statement, or a default constructed statement (nullptr for pointers) if there is none.
+         **************************************************************************************************************/
+        Statement take(const std::string& query)
+        {
+            Statement output = {};
+
+            if (capacity > 0)
+            {
+                auto found = index.find(query);
+                if (found != index.end())
+                {
+                    output = found->second->second;
+                    entries.erase(found->second);
+                    index.erase(found);
+                    statistics.hits++;
+                }
+                else
+                {
+                    statistics.misses++;
+                }
+            }
+
+            return output;
+        }
+
+        /***************************************************************************************************************
+         * This function puts a statement into the cache as the most recently used one. If the cache is full the least
+         * recently used statement will be finalized. If the cache is disabled, or it already holds a statement for the
+         * same query, the given statement is finalized instead.
+         *
+         * @param query - the query text the statement was prepared from.
+         * @param statement - a statement that has been reset and is ready to be bound again.
+         **************************************************************************************************************/
+        void give(const std::string& query, Statement statement)
+        {
+            if (capacity == 0 || index.contains(query))
+            {
+                finalize(statement);
+            }
+            else
+            {
+                entries.emplace_front(query, statement);
+                index[query] = entries.begin();
+                evictDownTo(capacity);
+            }
+        }
+
+        /***************************************************************************************************************
+         * This function finalizes every statement held by the cache. Statistics are not reset.
+         **************************************************************************************************************/
+        void clear()
+        {
+            for (auto& entry : entries) finalize(entry.second);
+            entries.clear();
+            index.clear();
+        }
+
+        /***************************************************************************************************************
+         * This function changes the maximum number of statements held. Shrinking the cache will evict the least
+         * recently used statements. Setting this to 0 will empty and disable the cache.
+         **************************************************************************************************************/
+        void setCapacity(size_t capacity)
+        {
+            this->capacity = capacity;
+            evictDownTo(capacity);
+        }
+
+        Data::StatementCacheStatistics getStatistics() const
+        {
+            Data::StatementCacheStatistics output = statistics;
+            output.size = entries.size();
+            output.capacity = capacity;
+            return output;
+        }
+
+        ~StatementCache()
+        {
+            clear();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -5,7 +5,11 @@
 * See LICENSE on root project directory for terms
 * of use.
 ********************************************************/
+#include <limits>
+#include <charconv>
+#include <sstream>
 #include <iostream>
+#include <algorithm>
 #include "MariaDBConnection.h++"
 
 using namespace std;
@@ -14,6 +18,139 @@ using namespace StiltFox::StorageShed::Data;
 
 namespace StiltFox::StorageShed
 {
+    static void readColumns(ResultTable& table, ResultSet& results, vector<int32_t>& columnTypes)
+    {
+        ResultSetMetaData* metaData = results.getMetaData();
+        vector<string> columnNames;
+
+        columnTypes.clear();
+        for (uint32_t z=1; z<=metaData->getColumnCount(); z++)
+        {
+            const int32_t type = metaData->getColumnType(z);
+            columnNames.emplace_back(metaData->getColumnName(z).c_str());
+            // an unsigned bigint can be too large for an int64, so it is read as text
+            columnTypes.emplace_back(type == BIGINT && !metaData->isSigned(z) ? VARCHAR : type);
+        }
+        table.setColumnNames(columnNames);
+    }
+
+    static size_t appendRow(ResultTable& table, ResultSet& results, const vector<int32_t>& columnTypes)
+    {
+        size_t bytes = 0;
+
+        for (int z=0; z<columnTypes.size(); z++)
+        {
+            // Integers and floating point numbers are read as numbers, the same as sqlite gives them back. Floating
+            // point numbers also keep the text the server sent so getString matches performQuery. Decimals and
+            // unsigned bigints are kept exactly as the server formats them, and can still be read as a number through
+            // getInteger or getReal.
+            switch (columnTypes[z])
+            {
+                case TINYINT:
+                case SMALLINT:
+                case INTEGER:
+                case BIGINT:
+                {
+                    const int64_t value = results.getLong(z+1);
+                    if (results.wasNull())
+                    {
+                        table.appendNull();
+                    }
+                    else
+                    {
+                        table.appendInteger(value);
+                        bytes += sizeof(int64_t);
+                    }
+                    break;
+                }
+                case FLOAT:
+                case REAL:
+                case DOUBLE:
+                {
+                    const SQLString text = results.getString(z+1);
+                    if (results.wasNull())
+                    {
+                        table.appendNull();
+                    }
+                    else
+                    {
+                        double value = 0;
+                        from_chars(text.c_str(), text.c_str() + text.length(), value);
+                        table.appendReal(value, string_view(text.c_str(), text.length()));
+                        bytes += sizeof(double) + text.length();
+                    }
+                    break;
+                }
+                case BINARY:
+                case VARBINARY:
+                case LONGVARBINARY:
+                case BLOB:
+                {
+                    const SQLString value = results.getString(z+1);
+                    if (results.wasNull()) table.appendNull();
+                    else table.appendBlob(string_view(value.c_str(), value.length()));
+                    bytes += value.length();
+                    break;
+                }
+                default:
+                {
+                    const SQLString value = results.getString(z+1);
+                    if (results.wasNull()) table.appendNull();
+                    else table.appendText(string_view(value.c_str(), value.length()));
+                    bytes += value.length();
+                }
+            }
+        }
+
+        return bytes;
+    }
+
+    // the same message the server gives a query that was killed
+    static const string interruptedError = "Query execution was interrupted";
+
+    // the value executeBatch gives back for a row that ran but has no count, the same as JDBC's SUCCESS_NO_INFO
+    static const int32_t successNoInfo = -2;
+
+    static const string getTablesQuery = "select concat(TABLE_SCHEMA, '.', TABLE_NAME) as TABLE_NAME "
+                                         "from information_schema.TABLES "
+                                         "where TABLE_SCHEMA not in "
+                                         "('information_schema', 'mysql', 'performance_schema', 'sys');";
+
+    // This covers exactly the columns getMetaData reads, so any change it would see, including to views, changes the
+    // fingerprint, while only one row comes back from the server.
+    static const string getSchemaFingerprintQuery =
+        "select count(*) as COLUMN_COUNT, "
+        "coalesce(sum(crc32(concat_ws('.', TABLE_SCHEMA, TABLE_NAME, COLUMN_NAME, COLUMN_TYPE))), 0) as CHECKSUM "
+        "from information_schema.COLUMNS "
+        "where TABLE_SCHEMA not in ('information_schema', 'mysql', 'performance_schema');";
+
+    static void bindParameter(PreparedStatement& statement, int index, const Parameter& parameter,
+                              vector<unique_ptr<istringstream>>& blobStreams)
+    {
+        if (holds_alternative<int64_t>(parameter))
+        {
+            statement.setLong(index, get<int64_t>(parameter));
+        }
+        else if (holds_alternative<double>(parameter))
+        {
+            statement.setDouble(index, get<double>(parameter));
+        }
+        else if (holds_alternative<string>(parameter))
+        {
+            statement.setString(index, get<string>(parameter));
+        }
+        else if (holds_alternative<Blob>(parameter))
+        {
+            // the driver reads blobs from a stream when the batch is executed, so the stream has to outlive this call
+            blobStreams.emplace_back(make_unique<istringstream>(get<Blob>(parameter).bytes));
+            statement.setBlob(index, blobStreams.back().get());
+        }
+        else
+        {
+            statement.setNull(index, _NULL);
+        }
+    }
+
     MariaDBConnection::MariaDBConnection(const ConnectionInformation& connectionInformation)
     {
         this->connectionInformation = connectionInformation;
@@ -21,7 +158,10 @@ namespace StiltFox::StorageShed
     }
 
     MariaDBConnection::MariaDBConnection(const MariaDBConnection& toCopy) : MariaDBConnection(toCopy.connectionInformation)
-    {}
+    {
+        statementCache.setCapacity(toCopy.statementCache.getStatistics().capacity);
+        blockCommitsForParallelReads = toCopy.blockCommitsForParallelReads;
+    }
 
     bool MariaDBConnection::connect()
     {
@@ -31,6 +171,9 @@ namespace StiltFox::StorageShed
         {
             connection = DriverManager::getConnection(connectionInformation.getJDBCStringWithoutParameters(),
                 connectionInformation.parameters);
+            const unique_ptr<Statement> statement(connection->createStatement());
+            const unique_ptr<ResultSet> results(statement->executeQuery("select connection_id()"));
+            if (results->next()) serverConnectionId = results->getLong(1);
             output = true;
         }
         catch (SQLException& e)
@@ -44,6 +187,10 @@ namespace StiltFox::StorageShed
 
     void MariaDBConnection::disconnect()
     {
+        serverConnectionId = 0;
+        workerPool.reset();
+        metaDataCache.invalidate();
+        statementCache.clear();
         if (connection != nullptr)
         {
             connection->close();
@@ -81,6 +228,7 @@ namespace StiltFox::StorageShed
             output.connected = true;
             try
             {
+                metaDataCache.invalidate();
                 if (!connection->getAutoCommit())
                 {
                     connection->rollback();
@@ -128,12 +276,148 @@ namespace StiltFox::StorageShed
     Result<void*> MariaDBConnection::performUpdate(const StructuredQuery& statement)
     {
         const auto output = performQuery(statement);
-        return {output.connected, output.rowsEffected, output.errorText, output.performedQueries, nullptr};
+        return {output.connected, output.rowsEffected, output.errorText, output.performedQueries, nullptr,
+            output.metrics};
     }
 
-    unordered_set<string> MariaDBConnection::validate(TableDefinitions tableDefinitions, bool strict)
+    Result<void*> MariaDBConnection::executeBatch(const string& query, const vector<ParameterRow>& parameterRows)
     {
-        return {};
+        Result<void*> output = {false, 0, "", {{query, {}}}, nullptr};
+        QueryMetrics metrics;
+        QueryTimer timer(instrumentation.isEnabled());
+
+        if (isConnected() && interrupted)
+        {
+            output.connected = true;
+            output.errorText = interruptedError;
+        }
+        else if (isConnected())
+        {
+            output.connected = true;
+            bool implicitTransaction = false;
+
+            try
+            {
+                implicitTransaction = connection->getAutoCommit();
+                if (implicitTransaction) connection->setAutoCommit(false);
+
+                unique_ptr<PreparedStatement> statement(statementCache.take(query));
+                if (statement == nullptr) statement.reset(connection->prepareStatement(query));
+
+                const int numParameters = statement->getParameterMetaData()->getParameterCount();
+                vector<unique_ptr<istringstream>> blobStreams;
+
+                for (const ParameterRow& row : parameterRows)
+                {
+                    for (int x=0; x<numParameters; x++)
+                    {
+                        if (x<row.size())
+                            bindParameter(*statement, x+1, row[x], blobStreams);
+                        else
+                            statement->setNull(x+1, _NULL);
+                    }
+                    statement->addBatch();
+                }
+                timer.lap(metrics.prepare);
+
+                // In the useBulkStmts and rewriteBatchedStatements modes the server does not say how many rows each
+                // entry changed, so the driver reports SUCCESS_NO_INFO and each of those entries is counted as one row.
+                const Ints& counts = statement->executeBatch();
+                for (size_t x=0; x<counts.size(); x++)
+                {
+                    if (counts[x] > 0) output.rowsEffected += counts[x];
+                    else if (counts[x] == successNoInfo) output.rowsEffected++;
+                }
+                statement->clearBatch();
+
+                if (implicitTransaction)
+                {
+                    connection->commit();
+                    connection->setAutoCommit(true);
+                }
+
+                if (isSchemaChange(query))
+                {
+                    statementCache.clear();
+                    metaDataCache.invalidate();
+                }
+                else
+                {
+                    statementCache.give(query, statement.release());
+                }
+                timer.lap(metrics.execute);
+            }
+            catch (SQLException& e)
+            {
+                timer.lap(metrics.execute);
+                output.errorText = e.what();
+                if (implicitTransaction)
+                {
+                    try
+                    {
+                        metaDataCache.invalidate();
+                        connection->rollback();
+                        connection->setAutoCommit(true);
+                        output.rowsEffected = 0;
+                    }
+                    catch (SQLException& rollbackError)
+                    {
+                        output.errorText += " ";
+                        output.errorText += rollbackError.what();
+                    }
+                }
+            }
+
+            if (instrumentation.isEnabled())
+            {
+                output.metrics = metrics;
+                instrumentation.record(output.performedQueries.front(), metrics);
+            }
+        }
+
+        return output;
+    }
+
+    unordered_set<string> MariaDBConnection::validate(const TableDefinitions& tableDefinitions, bool strict)
+    {
+        unordered_set<string> output;
+
+        if (isConnected())
+        {
+            // The fingerprint is worked out on the server, so checking it only sends one row back instead of every
+            // column. The server still has to read all of information_schema.COLUMNS to work it out, so a cache hit
+            // only saves sending and parsing the structure, not the scan. MariaDB has no cheaper value that changes
+            // for every alter and every replaced view. Changes made by this connection also clear the cache straight
+            // away.
+            const auto fingerprint = performQuery(getSchemaFingerprintQuery);
+
+            if (fingerprint.errorText.empty() && !fingerprint.data.empty())
+            {
+                const string version =
+                    fingerprint.data[0].at("COLUMN_COUNT") + ":" + fingerprint.data[0].at("CHECKSUM");
+                if (!metaDataCache.isCurrent(version))
+                {
+                    auto metaData = getMetaData();
+                    if (metaData.errorText.empty())
+                        metaDataCache.store(version, std::move(metaData.data));
+                    else
+                        output.emplace(metaData.errorText);
+                }
+            }
+            else
+            {
+                output.emplace(fingerprint.errorText);
+            }
+
+            if (output.empty())
+                output = compareTableDefinitions(tableDefinitions, metaDataCache.getDefinitions(), strict);
+        }
+        else
+        {
+            output.emplace("Database not connected " + connectionInformation.getJDBCStringWithoutParameters());
+        }
+
+        return output;
     }
 
     Result<TableDefinitions> MariaDBConnection::getMetaData()
@@ -154,7 +438,13 @@ namespace StiltFox::StorageShed
             definitions[row.at("TABLE_NAME")][row.at("COLUMN_NAME")] = row.at("COLUMN_TYPE");
 
         return {rawData.connected, rawData.rowsEffected, rawData.errorText, rawData.performedQueries,
-            definitions};
+            definitions, rawData.metrics};
+    }
+
+    Result<TableDefinitions> MariaDBConnection::getMetaData(size_t workers)
+    {
+        // every column of every table already comes back from a single query, so there is nothing to split up
+        return getMetaData();
     }
 
     Result<QueryReturnData> MariaDBConnection::performQuery(string query)
@@ -164,14 +454,70 @@ namespace StiltFox::StorageShed
 
     Result<QueryReturnData> MariaDBConnection::performQuery(StructuredQuery query)
     {
-        Result<QueryReturnData> output = {false, 0, "", {query}, {}};
+        QueryReturnData data;
+        const Result<void*> status = executeStatement(query, [&data](ResultSet& results, size_t& bytes)
+        {
+            const int columns = results.getMetaData()->getColumnCount();
+            data.emplace_back();
+            for (int z=0; z<columns; z++)
+            {
+                const string columnValue = results.getString(z+1).c_str();
+                bytes += columnValue.size();
+                data[data.size() - 1][results.getMetaData()->getColumnName(z+1).c_str()] = columnValue;
+            }
+            return true;
+        });
 
-        if (isConnected())
+        return {status.connected, status.rowsEffected, status.errorText, status.performedQueries, data, status.metrics};
+    }
+
+    Result<ResultTable> MariaDBConnection::performTableQuery(string query)
+    {
+        return performTableQuery(StructuredQuery{query, {}});
+    }
+
+    Result<ResultTable> MariaDBConnection::performTableQuery(const StructuredQuery& query)
+    {
+        ResultTable data;
+        vector<int32_t> columnTypes;
+        const Result<void*> status = executeStatement(query,
+            [&data, &columnTypes](ResultSet& results, size_t& bytes)
+            {
+                bytes += appendRow(data, results, columnTypes);
+                return true;
+            }, 0, [&data, &columnTypes](ResultSet& results) { readColumns(data, results, columnTypes); });
+
+        return {status.connected, status.rowsEffected, status.errorText, status.performedQueries, data, status.metrics};
+    }
+
+    Result<void*> MariaDBConnection::executeStatement(const StructuredQuery& query,
+                                                      const function<bool(ResultSet&, size_t& bytes)>& onRow,
+                                                      int32_t fetchSize,
+                                                      const function<void(ResultSet&)>& onColumns)
+    {
+        Result<void*> output = {false, 0, "", {query}, nullptr};
+        QueryMetrics metrics;
+        QueryTimer timer(instrumentation.isEnabled());
+
+        if (isConnected() && interrupted)
+        {
+            // the kill sent by interrupt only reaches a query that is already on the server
+            output.connected = true;
+            output.errorText = interruptedError;
+        }
+        else if (isConnected())
         {
             output.connected = true;
+            // the same as rollbackTransaction, the cached structure is thrown away so validate reads it again
+            if (isRollback(query.query)) metaDataCache.invalidate();
             try
             {
-                const unique_ptr<PreparedStatement> statement(connection->prepareStatement(query.query));
+                unique_ptr<PreparedStatement> statement(statementCache.take(query.query));
+                if (statement == nullptr)
+                    statement.reset(connection->prepareStatement(query.query));
+                else
+                    statement->clearParameters();
+
                 int numParameters = statement->getParameterMetaData()->getParameterCount();
 
                 for (int x=0; x<numParameters; x++)
@@ -186,56 +532,231 @@ namespace StiltFox::StorageShed
                     }
                 }
 
-                const unique_ptr<ResultSet> results(statement->executeQuery());
+                timer.lap(metrics.prepare);
 
-                while (results->next())
                 {
-                    const int columns = results->getMetaData()->getColumnCount();
-                    output.data.emplace_back();
-                    for (int z=0; z<columns; z++)
+                    statement->setFetchSize(fetchSize);
+                    const unique_ptr<ResultSet> results(statement->executeQuery());
+                    bool keepGoing = true;
+                    if (onColumns) onColumns(*results);
+                    timer.lap(metrics.execute);
+
+                    while (keepGoing && results->next())
                     {
-                        const string columnValue = results->getString(z+1).c_str();
-                        output.data[output.data.size() - 1][results->getMetaData()->getColumnName(z+1).c_str()] =
-                            columnValue;
+                        timer.lap(metrics.fetch);
+                        metrics.rows++;
+                        keepGoing = onRow(*results, metrics.bytes);
+                        timer.lap(metrics.materialize);
                     }
+                    timer.lap(metrics.fetch);
                 }
                 output.rowsEffected = statement->getUpdateCount();
+
+                if (isSchemaChange(query.query))
+                {
+                    statementCache.clear();
+                    metaDataCache.invalidate();
+                }
+                else
+                {
+                    statementCache.give(query.query, statement.release());
+                }
             }
             catch (SQLException& e)
             {
+                timer.lap(metrics.execute);
                 output.errorText = e.what();
             }
+
+            if (instrumentation.isEnabled())
+            {
+                output.metrics = metrics;
+                instrumentation.record(query, metrics);
+            }
         }
 
         return output;
     }
 
-    Result<MultiTableData> MariaDBConnection::getAllData()
+    Result<void*> MariaDBConnection::streamQuery(const StructuredQuery& query,
+                                                 const function<bool(const ResultTable::RowView&)>& visitor)
     {
-        const string tableQuery = "select concat(TABLE_SCHEMA, '.', TABLE_NAME) as TABLE_NAME "
-                                  "from information_schema.TABLES "
-                                  "where TABLE_SCHEMA not in "
-                                  "('information_schema', 'mysql', 'performance_schema', 'sys');";
-        Result<MultiTableData> output = {false, 0, "", {}, {}};
+        ResultTable row;
+        vector<int32_t> columnTypes;
 
-        auto tables = performQuery(tableQuery);
+        // A fetch size above 0 makes the driver read the rows from the server in chunks as they are needed, instead
+        // of buffering the whole result on the client.
+        return executeStatement(query, [&row, &columnTypes, &visitor](ResultSet& results, size_t& bytes)
+        {
+            row.clearRows();
+            bytes += appendRow(row, results, columnTypes);
+            return visitor(row[0]);
+        }, 1000, [&row, &columnTypes](ResultSet& results) { readColumns(row, results, columnTypes); });
+    }
+
+    Result<void*> MariaDBConnection::streamAllData(const function<bool(const string&, const ResultTable&)>& sink,
+                                                   size_t batchSize)
+    {
+        Result<void*> output = {false, 0, "", {}, nullptr};
+
+        // The driver takes the fetch size as an int32, and a fetch size of 0 would buffer the whole table on the client
+        // instead of streaming it.
+        const int32_t fetchSize = (int32_t)clamp<size_t>(batchSize, 1, numeric_limits<int32_t>::max());
+        auto tables = performQuery(getTablesQuery);
         output.connected = tables.connected;
+        output.errorText = tables.errorText;
         if (tables.errorText.empty())
         {
-            for (const auto& row : tables.data)
+            bool keepGoing = true;
+            for (size_t x=0; keepGoing && x<tables.data.size(); x++)
             {
-                string selectQuery = "select * from " + row.at("TABLE_NAME") + ";";
-                auto tableData = performQuery(selectQuery);
-
-                output.data[row.at("TABLE_NAME")] = tableData.data;
+                const string& table = tables.data[x].at("TABLE_NAME");
+                string selectQuery = "select * from " + table + ";";
+                ResultTable batch;
+                vector<int32_t> columnTypes;
+                bool sentBatch = false;
+
+                auto tableData = executeStatement({selectQuery, {}},
+                    [&batch, &columnTypes, &keepGoing, &sentBatch, &sink, &table, batchSize]
+                    (ResultSet& results, size_t& bytes)
+                    {
+                        bytes += appendRow(batch, results, columnTypes);
+                        if (batch.getRowCount() >= batchSize)
+                        {
+                            keepGoing = sink(table, batch);
+                            sentBatch = true;
+                            batch.clearRows();
+                        }
+                        return keepGoing;
+                    }, fetchSize,
+                    [&batch, &columnTypes](ResultSet& results) { readColumns(batch, results, columnTypes); });
+
+                if (keepGoing && (batch.getRowCount() > 0 || !sentBatch)) keepGoing = sink(table, batch);
                 output.performedQueries.emplace_back(selectQuery);
-                if (!output.errorText.empty()) break;
+                if (!tableData.errorText.empty())
+                {
+                    if (!output.errorText.empty()) output.errorText += " ";
+                    output.errorText += tableData.errorText;
+                }
+                if (tableData.metrics)
+                {
+                    if (!output.metrics) output.metrics.emplace();
+                    *output.metrics += *tableData.metrics;
+                }
             }
         }
 
         return output;
     }
 
+    Result<MultiTableData> MariaDBConnection::getAllData()
+    {
+        MultiTableData data;
+        const Result<void*> status = streamAllData([&data](const string& table, const ResultTable& rows)
+        {
+            QueryReturnData& tableData = data[table];
+            for (Row& row : rows.toQueryReturnData()) tableData.emplace_back(std::move(row));
+            return true;
+        });
+
+        return {status.connected, status.rowsEffected, status.errorText, status.performedQueries, data, status.metrics};
+    }
+
+    Result<MultiTableData> MariaDBConnection::getAllData(size_t workers)
+    {
+        if (workers <= 1 || !isConnected()) return getAllData();
+
+        Result<MultiTableData> output = {true, 0, "", {}, {}};
+        if (workerPool == nullptr || workerPool->getOptions().maximumSize < workers)
+        {
+            ConnectionPoolOptions<MariaDBConnection> options;
+            options.minimumSize = 0;
+            options.maximumSize = workers;
+            workerPool = make_unique<ConnectionPool<MariaDBConnection>>(*this, options);
+        }
+        auto leases = workerPool->acquireUpTo(workers);
+        if (leases.empty()) return getAllData();
+
+        // Blocking commits keeps anything from changing while every worker opens its snapshot, so the snapshots all
+        // match. It needs the RELOAD privilege and can not be done in the middle of a transaction.
+        bool blocked = false;
+        if (blockCommitsForParallelReads)
+        {
+            try
+            {
+                blocked = connection->getAutoCommit() && performUpdate("backup stage start").errorText.empty();
+            }
+            catch (SQLException&) {}
+            if (blocked && !performUpdate("backup stage block_commit").errorText.empty())
+            {
+                performUpdate("backup stage end");
+                blocked = false;
+            }
+        }
+
+        size_t snapshots = 0;
+        while (snapshots < leases.size() &&
+            leases[snapshots]->performUpdate("start transaction with consistent snapshot, read only").errorText.empty())
+            snapshots++;
+        const auto tables = snapshots == leases.size() ? performQuery(getTablesQuery) : Result<QueryReturnData>{};
+        if (blocked) performUpdate("backup stage end");
+
+        if (snapshots < leases.size())
+        {
+            // a worker without a snapshot would read whatever is committed at the time, so read on this connection
+            for (size_t x=0; x<snapshots; x++) leases[x]->performUpdate("rollback");
+            leases.clear();
+            return getAllData();
+        }
+
+        output.errorText = tables.errorText;
+        if (tables.errorText.empty())
+        {
+            vector<Result<QueryReturnData>> tableData(tables.data.size());
+            ConnectionPool<MariaDBConnection>::spreadWork(leases, tables.data.size(),
+                [&tables, &tableData, instrumented = instrumentation.isEnabled()]
+                (MariaDBConnection& worker, size_t table)
+                {
+                    // workers time their own queries, the timings are recorded here once everyone is done
+                    if (instrumented) worker.enableInstrumentation();
+                    else worker.disableInstrumentation();
+
+                    // the rows are converted here so that the conversion is spread over the workers too
+                    const auto rows = worker.performTableQuery("select * from " +
+                        tables.data[table].at("TABLE_NAME") + ";");
+                    tableData[table] = {rows.connected, rows.rowsEffected, rows.errorText, rows.performedQueries,
+                        rows.data.toQueryReturnData(), rows.metrics};
+                });
+
+            for (size_t x=0; x<tableData.size(); x++)
+            {
+                output.data[tables.data[x].at("TABLE_NAME")] = std::move(tableData[x].data);
+                output.performedQueries.emplace_back(tableData[x].performedQueries.front());
+                if (!tableData[x].errorText.empty())
+                {
+                    if (!output.errorText.empty()) output.errorText += " ";
+                    output.errorText += tableData[x].errorText;
+                }
+                if (tableData[x].metrics)
+                {
+                    instrumentation.record(tableData[x].performedQueries.front(), *tableData[x].metrics);
+                    if (!output.metrics) output.metrics.emplace();
+                    *output.metrics += *tableData[x].metrics;
+                }
+            }
+        }
+        for (auto& lease : leases)
+        {
+            const auto committed = lease->performUpdate("commit");
+            if (!committed.errorText.empty())
+            {
+                if (!output.errorText.empty()) output.errorText += " ";
+                output.errorText += committed.errorText;
+            }
+        }
+
+        return output;
+    }
 
     bool MariaDBConnection::isConnected()
     {
@@ -251,11 +772,70 @@ namespace StiltFox::StorageShed
         return connectionInformation.toJDBCString();
     }
 
+    void MariaDBConnection::setStatementCacheSize(size_t size)
+    {
+        statementCache.setCapacity(size);
+    }
+
+    void MariaDBConnection::clearStatementCache()
+    {
+        statementCache.clear();
+    }
+
+    StatementCacheStatistics MariaDBConnection::getStatementCacheStatistics()
+    {
+        return statementCache.getStatistics();
+    }
+
     MariaDBConnection::~MariaDBConnection()
     {
         MariaDBConnection::disconnect();
     }
 
+    void MariaDBConnection::enableInstrumentation(chrono::nanoseconds slowQueryThreshold,
+        const function<void(const StructuredQuery&, const QueryMetrics&)>& onSlowQuery)
+    {
+        instrumentation.enable(slowQueryThreshold, onSlowQuery);
+    }
+
+    void MariaDBConnection::disableInstrumentation()
+    {
+        instrumentation.disable();
+    }
+
+    unordered_map<string, LatencyHistogram> MariaDBConnection::getLatencyHistograms()
+    {
+        return instrumentation.getHistograms();
+    }
+
+    void MariaDBConnection::clearLatencyHistograms()
+    {
+        instrumentation.clearHistograms();
+    }
+
+    void MariaDBConnection::setBlockCommitsForParallelReads(bool block)
+    {
+        blockCommitsForParallelReads = block;
+    }
+
+    void MariaDBConnection::interrupt()
+    {
+        // The driver can not cancel a query from another thread, so the server is asked to kill it over a second
+        // connection. Only the running query is killed, this connection stays open.
+        interrupted = true;
+        const int64_t id = serverConnectionId;
+        if (id != 0)
+        {
+            MariaDBConnection killer = connectionInformation;
+            if (killer.connect()) killer.performUpdate("kill query " + to_string(id));
+        }
+    }
+
+    void MariaDBConnection::clearInterrupt()
+    {
+        interrupted = false;
+    }
+
     MariaDBConnection& MariaDBConnection::operator=(const ConnectionInformation& connectionInformation)
     {
         this->connectionInformation = connectionInformation;
@@ -8,11 +8,33 @@
 #ifndef Stilt_Fox_7f34044c89ad492ebe326eeda332de02
 #define Stilt_Fox_7f34044c89ad492ebe326eeda332de02
 #include <string>
+#include <memory>
+#include <atomic>
+#include <functional>
 #include <mariadb/conncpp.hpp>
 #include "DatabaseConnection.h++"
+#include "StatementCache.h++"
+#include "ConnectionPool.h++"
+#include "QueryInstrumentation.h++"
+#include "MetaDataCache.h++"
 
 namespace StiltFox::StorageShed
 {
+    /*******************************************************************************************************************
+     * This class is a MariaDB implementation of DatabaseConnection.
+     *
+     * executeBatch sends its rows using the driver's batch support. Adding useBulkStmts=true or
+     * rewriteBatchedStatements=true to the connection parameters lets the driver send the whole batch to the server in
+     * as few round trips as possible. In those modes the server does not report how many rows each entry of the batch
+     * changed, so rowsEffected is the number of entries that ran rather than the number of rows they changed.
+     *
+     * validate keeps the structure it read and only reads it again when a checksum of information_schema.COLUMNS
+     * changes. Working out the checksum still makes the server scan every column of every schema, so validate is
+     * cheaper when nothing changed but is not free on servers with a very large number of tables.
+     *
+     * Opening a connection means a full handshake with the server. Threads that need their own connections should
+     * lease them from a ConnectionPool built from the ConnectionInformation instead of connecting for every request.
+     ******************************************************************************************************************/
     class MariaDBConnection : public DatabaseConnection
     {
         public:
@@ -29,6 +51,18 @@ namespace StiltFox::StorageShed
         private:
         sql::Connection* connection;
         ConnectionInformation connectionInformation;
+        Data::Result<void*> executeStatement(const Data::StructuredQuery& query,
+            const std::function<bool(sql::ResultSet&, size_t& bytes)>& onRow, int32_t fetchSize = 0,
+            const std::function<void(sql::ResultSet&)>& onColumns = {});
+        StatementCache<sql::PreparedStatement*> statementCache = {[](sql::PreparedStatement* statement){delete statement;}};
+        std::unique_ptr<ConnectionPool<MariaDBConnection>> workerPool;
+        QueryInstrumentation instrumentation;
+        MetaDataCache metaDataCache;
+        // the id the server gave this connection, used by interrupt to find the query to kill
+        std::atomic<int64_t> serverConnectionId = 0;
+        // set by interrupt, so a query that had not reached the server when the kill was sent is stopped too
+        std::atomic<bool> interrupted = false;
+        bool blockCommitsForParallelReads = false;
 
         public:
         MariaDBConnection(const ConnectionInformation& connectionInformation);
@@ -41,13 +75,47 @@ namespace StiltFox::StorageShed
         Data::Result<void*> commitTransaction() override;
         Data::Result<void*> performUpdate(std::string statement) override;
         Data::Result<void*> performUpdate(const Data::StructuredQuery& statement) override;
-        std::unordered_set<std::string> validate(Data::TableDefinitions tableDefinitions, bool strict) override;
+        Data::Result<void*> executeBatch(const std::string& query,
+            const std::vector<Data::ParameterRow>& parameterRows) override;
+        std::unordered_set<std::string> validate(const Data::TableDefinitions& tableDefinitions, bool strict) override;
         Data::Result<Data::TableDefinitions> getMetaData() override;
+        // the whole structure comes back from one query, so this reads serially on this connection and ignores workers
+        Data::Result<Data::TableDefinitions> getMetaData(size_t workers) override;
         Data::Result<Data::QueryReturnData> performQuery(std::string query) override;
         Data::Result<Data::QueryReturnData> performQuery(Data::StructuredQuery query) override;
+        Data::Result<Data::ResultTable> performTableQuery(std::string query) override;
+        Data::Result<Data::ResultTable> performTableQuery(const Data::StructuredQuery& query) override;
         Data::Result<Data::MultiTableData> getAllData() override;
+        Data::Result<Data::MultiTableData> getAllData(size_t workers) override;
+        Data::Result<void*> streamQuery(const Data::StructuredQuery& query,
+            const std::function<bool(const Data::ResultTable::RowView&)>& visitor) override;
+        Data::Result<void*> streamAllData(
+            const std::function<bool(const std::string& table, const Data::ResultTable& rows)>& sink,
+            size_t batchSize = 1000) override;
         bool isConnected() override;
         std::string getConnectionString() override;
+        void setStatementCacheSize(size_t size) override;
+        void clearStatementCache() override;
+        Data::StatementCacheStatistics getStatementCacheStatistics() override;
+        void enableInstrumentation(std::chrono::nanoseconds slowQueryThreshold = std::chrono::nanoseconds::max(),
+            const std::function<void(const Data::StructuredQuery&, const Data::QueryMetrics&)>& onSlowQuery = {})
+            override;
+        void disableInstrumentation() override;
+        std::unordered_map<std::string, Data::LatencyHistogram> getLatencyHistograms() override;
+        void clearLatencyHistograms() override;
+        void interrupt() override;
+        void clearInterrupt() override;
+
+        /***************************************************************************************************************
+         * By default each getAllData(workers) worker opens its own consistent snapshot, so every table is read
+         * consistently, but the workers' snapshots can be a few moments apart. Turning this on makes getAllData block
+         * commits on the whole server with BACKUP STAGE BLOCK_COMMIT while the workers open their snapshots, so they
+         * all read the same one. This needs the RELOAD privilege. Without it, or in the middle of a transaction,
+         * getAllData carries on without blocking.
+         *
+         * @param block - true to block commits while the snapshots are opened. This is false by default.
+         **************************************************************************************************************/
+        void setBlockCommitsForParallelReads(bool block);
 
         MariaDBConnection& operator=(const ConnectionInformation& connectionInformation);
         ~MariaDBConnection();
@@ -1,7 +1,5 @@
-#include <Stilt_Fox/Scribe/File.h++>
 #include "SqliteConnection.h++"
 
-using namespace StiltFox::Scribe;
 using namespace StiltFox::StorageShed;
 using namespace StiltFox::StorageShed::Data;
 using namespace std;
@@ -14,7 +12,17 @@ SqliteConnection::SqliteConnection(const char* connection)
     this->connection = nullptr;
 }
 
-SqliteConnection::SqliteConnection(const SqliteConnection& toCopy) : SqliteConnection(toCopy.connectionString){}
+SqliteConnection::SqliteConnection(const string& connection, const Options& options)
+    : SqliteConnection(connection.c_str())
+{
+    this->options = options;
+}
+
+SqliteConnection::SqliteConnection(const SqliteConnection& toCopy)
+    : SqliteConnection(toCopy.connectionString, toCopy.options)
+{
+    statementCache.setCapacity(toCopy.statementCache.getStatistics().capacity);
+}
 
 SqliteConnection::~SqliteConnection()
 {
@@ -24,13 +32,157 @@ SqliteConnection::~SqliteConnection()
 SqliteConnection& SqliteConnection::operator=(const string& connection)
 {
     connectionString = connection;
+    workerPool.reset();
+    metaDataCache.invalidate();
     return *this;
 }
 
-bool SqliteConnection::checkIfValidSqlDatabase() const
+ConnectionPoolOptions<SqliteConnection> SqliteConnection::getPoolOptions(size_t maximumSize,
+    chrono::milliseconds busyTimeout)
+{
+    ConnectionPoolOptions<SqliteConnection> output;
+    output.maximumSize = maximumSize;
+    output.maximumWriters = 1;
+    output.onConnect = [busyTimeout](SqliteConnection& connection)
+    {
+        sqlite3_busy_timeout(connection.connection, (int)busyTimeout.count());
+        return sqlite3_exec(connection.connection, "PRAGMA journal_mode = WAL;", nullptr, nullptr, nullptr) ==
+            SQLITE_OK;
+    };
+
+    return output;
+}
+
+static void readColumns(ResultTable& table, sqlite3_stmt* statement)
+{
+    const int columns = sqlite3_column_count(statement);
+    vector<string> columnNames;
+
+    for (int z=0; z<columns; z++) columnNames.emplace_back(sqlite3_column_name(statement, z));
+    table.setColumnNames(columnNames);
+}
+
+static void appendRow(ResultTable& table, sqlite3_stmt* statement)
+{
+    const int columns = sqlite3_data_count(statement);
+
+    for (int z=0; z<columns; z++)
+    {
+        switch (sqlite3_column_type(statement, z))
+        {
+            case SQLITE_INTEGER:
+                table.appendInteger(sqlite3_column_int64(statement, z));
+                break;
+            case SQLITE_FLOAT:
+                table.appendReal(sqlite3_column_double(statement, z));
+                break;
+            case SQLITE_TEXT:
+                table.appendText(string_view((const char*)sqlite3_column_text(statement, z),
+                    sqlite3_column_bytes(statement, z)));
+                break;
+            case SQLITE_BLOB:
+                table.appendBlob(string_view((const char*)sqlite3_column_blob(statement, z),
+                    sqlite3_column_bytes(statement, z)));
+                break;
+            default:
+                table.appendNull();
+        }
+    }
+}
+
+static size_t getRowBytes(sqlite3_stmt* statement)
+{
+    size_t output = 0;
+    const int columns = sqlite3_data_count(statement);
+
+    for (int z=0; z<columns; z++)
+    {
+        switch (sqlite3_column_type(statement, z))
+        {
+            case SQLITE_INTEGER:
+            case SQLITE_FLOAT:
+                output += 8;
+                break;
+            case SQLITE_NULL:
+                break;
+            default:
+                output += sqlite3_column_bytes(statement, z);
+        }
+    }
+
+    return output;
+}
+
+static void bindParameter(sqlite3_stmt* statement, int index, const Parameter& parameter)
 {
-    File dbFile = connectionString.c_str();
-    return dbFile.readFirstNCharacters(16) == "SQLite format 3\000" || dbFile.getSize() == 0;
+    if (holds_alternative<int64_t>(parameter))
+    {
+        sqlite3_bind_int64(statement, index, get<int64_t>(parameter));
+    }
+    else if (holds_alternative<double>(parameter))
+    {
+        sqlite3_bind_double(statement, index, get<double>(parameter));
+    }
+    else if (holds_alternative<string>(parameter))
+    {
+        const string& text = get<string>(parameter);
+        sqlite3_bind_text(statement, index, text.c_str(), text.size(), SQLITE_STATIC);
+    }
+    else if (holds_alternative<Blob>(parameter))
+    {
+        const string& bytes = get<Blob>(parameter).bytes;
+        sqlite3_bind_blob(statement, index, bytes.data(), bytes.size(), SQLITE_STATIC);
+    }
+    else
+    {
+        sqlite3_bind_null(statement, index);
+    }
+}
+
+SqliteConnection::Options SqliteConnection::Options::readHeavy()
+{
+    Options output;
+    output.mmapSize = 256 * 1024 * 1024;
+    output.cacheSize = -64 * 1024;
+    output.tempStore = "MEMORY";
+    return output;
+}
+
+SqliteConnection::Options SqliteConnection::Options::writeHeavy()
+{
+    Options output;
+    output.journalMode = "WAL";
+    output.synchronous = "NORMAL";
+    output.cacheSize = -64 * 1024;
+    output.tempStore = "MEMORY";
+    output.busyTimeout = chrono::seconds(5);
+    return output;
+}
+
+SqliteConnection::Options SqliteConnection::Options::inMemory()
+{
+    Options output;
+    output.create = true;
+    output.journalMode = "MEMORY";
+    output.synchronous = "OFF";
+    output.tempStore = "MEMORY";
+    return output;
+}
+
+static string getConnectPragmas(const SqliteConnection::Options& options)
+{
+    string output = options.foreignKeys ? "PRAGMA foreign_keys = ON;" : "";
+
+    if (!options.journalMode.empty()) output += "PRAGMA journal_mode = " + options.journalMode + ";";
+    if (!options.synchronous.empty()) output += "PRAGMA synchronous = " + options.synchronous + ";";
+    if (!options.tempStore.empty()) output += "PRAGMA temp_store = " + options.tempStore + ";";
+    if (options.cacheSize != 0) output += "PRAGMA cache_size = " + to_string(options.cacheSize) + ";";
+    if (options.mmapSize != 0) output += "PRAGMA mmap_size = " + to_string(options.mmapSize) + ";";
+    // reading the schema version makes sqlite read the file header, so a file that is not a database fails here
+    // instead of on the first query
+    output += "PRAGMA schema_version;";
+
+    return output;
 }
 
 void SqliteConnection::forEachTable(const function<void(string)>& perform, vector<StructuredQuery>& queryTracker) const
@@ -45,8 +197,7 @@ void SqliteConnection::forEachTable(const function<void(string)>& perform, vecto
 
     queryTracker.emplace_back(getTablesQuery);
 
-    if (sqlite3_prepare(dbConnection, getTablesQuery.query.c_str(), -1, &statement, nullptr) ==
-        SQLITE_OK)
+    if (sqlite3_prepare_v2(dbConnection, getTablesQuery.query.c_str(), -1, &statement, nullptr) == SQLITE_OK)
     {
         while(sqlite3_step(statement) == SQLITE_ROW) perform((char*)sqlite3_column_text(statement, 0));
     }
@@ -54,16 +205,97 @@ void SqliteConnection::forEachTable(const function<void(string)>& perform, vecto
     sqlite3_finalize(statement);
 }
 
+bool SqliteConnection::readTablesInParallel(size_t workers, vector<StructuredQuery>& queryTracker,
+                                            const function<void(const vector<string>&)>& onTables,
+                                            const function<void(SqliteConnection&, size_t)>& readTable)
+{
+    // in memory databases can not be shared with other connections, and a transaction that is already open may have
+    // changes the workers can not see
+    const char* file = isConnected() ? sqlite3_db_filename(connection, "main") : nullptr;
+    bool output = workers > 1 && file != nullptr && *file != '\0' && sqlite3_get_autocommit(connection) &&
+        sqlite3_exec(connection, "begin immediate;", nullptr, nullptr, nullptr) == SQLITE_OK;
+
+    if (output)
+    {
+        // The write lock keeps everyone else from changing the database while the workers open their snapshots, so
+        // every worker reads the same one.
+        vector<string> tables;
+        forEachTable([&tables](const string& table){tables.emplace_back(table);}, queryTracker);
+
+        if (workerPool == nullptr || workerPool->getOptions().maximumSize < workers)
+        {
+            // the workers only read, so they open the file read only and leave the journal mode alone
+            Options workerOptions = options;
+            workerOptions.readOnly = true;
+            workerOptions.create = false;
+            workerOptions.sharedCache = false;
+            workerOptions.journalMode.clear();
+
+            ConnectionPoolOptions<SqliteConnection> poolOptions;
+            poolOptions.minimumSize = 0;
+            poolOptions.maximumSize = workers;
+            workerPool = make_unique<ConnectionPool<SqliteConnection>>(
+                SqliteConnection(connectionString, workerOptions), poolOptions);
+        }
+
+        auto leases = workerPool->acquireUpTo(min(workers, tables.size()));
+        size_t snapshots = 0;
+        while (snapshots < leases.size() && leases[snapshots]->startTransaction().errorText.empty())
+        {
+            // sqlite only takes the snapshot once the transaction reads something
+            if (leases[snapshots]->performQuery("select count(*) from sqlite_schema;").errorText.empty())
+            {
+                snapshots++;
+            }
+            else
+            {
+                leases[snapshots]->rollbackTransaction();
+                break;
+            }
+        }
+
+        // Once every worker has its snapshot the write lock can be let go. With write ahead logging writers can carry
+        // on while the workers read, and in the other journal modes the workers' read locks hold off any commit.
+        sqlite3_exec(connection, "commit;", nullptr, nullptr, nullptr);
+
+        output = snapshots == leases.size() && (!leases.empty() || tables.empty());
+        if (output)
+        {
+            onTables(tables);
+            ConnectionPool<SqliteConnection>::spreadWork(leases, tables.size(), readTable);
+        }
+        for (size_t x=0; x<snapshots; x++) leases[x]->commitTransaction();
+    }
+
+    return output;
+}
+
 bool SqliteConnection::connect()
 {
-    if(connection == nullptr && checkIfValidSqlDatabase())
+    if(connection == nullptr)
     {
-        sqlite3* newConnection;
-        if (sqlite3_open(connectionString.c_str(), &newConnection) == SQLITE_OK)
+        int flags = (options.readOnly ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE) | SQLITE_OPEN_URI;
+        if (options.create && !options.readOnly) flags |= SQLITE_OPEN_CREATE;
+        if (options.noMutex) flags |= SQLITE_OPEN_NOMUTEX;
+        if (options.sharedCache) flags |= SQLITE_OPEN_SHAREDCACHE;
+
+        sqlite3* newConnection = nullptr;
+        if (sqlite3_open_v2(connectionString.c_str(), &newConnection, flags, nullptr) == SQLITE_OK)
         {
-            connection = newConnection;
-            performUpdate("PRAGMA foreign_keys = ON;");
+            if (options.busyTimeout > chrono::milliseconds::zero())
+                sqlite3_busy_timeout(newConnection, (int)options.busyTimeout.count());
+            // Unlike sqlite3_interrupt, which is forgotten if no statement is running, the flag stays set, so a
+            // statement that starts just after interrupt is called is stopped too.
+            sqlite3_progress_handler(newConnection, 1000, [](void* interrupted)
+            {
+                return ((atomic<bool>*)interrupted)->load() ? 1 : 0;
+            }, &interrupted);
+            if (sqlite3_exec(newConnection, getConnectPragmas(options).c_str(), nullptr, nullptr, nullptr) == SQLITE_OK)
+                connection = newConnection;
         }
+
+        // sqlite hands back a connection even when it fails to open, and it still has to be closed
+        if (connection == nullptr) sqlite3_close(newConnection);
     }
 
     return isConnected();
@@ -71,6 +303,9 @@ bool SqliteConnection::connect()
 
 void SqliteConnection::disconnect()
 {
+    workerPool.reset();
+    metaDataCache.invalidate();
+    statementCache.clear();
     sqlite3_close(connection);
     connection = nullptr;
 }
@@ -99,7 +334,101 @@ Result<void*> SqliteConnection::performUpdate(const string statement)
 Result<void*> SqliteConnection::performUpdate(const StructuredQuery& statement)
 {
     const Result<QueryReturnData> values = performQuery(statement);
-    return {values.connected, values.rowsEffected, values.errorText, values.performedQueries, nullptr};
+    return {values.connected, values.rowsEffected, values.errorText, values.performedQueries, nullptr,
+        values.metrics};
+}
+
+Result<void*> SqliteConnection::executeBatch(const string& query, const vector<ParameterRow>& parameterRows)
+{
+    Result<void*> output = {false, 0, "", {{query, {}}}, nullptr};
+    QueryMetrics metrics;
+    QueryTimer timer(instrumentation.isEnabled());
+
+    if (isConnected() && interrupted)
+    {
+        // a batch that is interrupted before it starts would never reach the progress handler
+        output.connected = true;
+        output.errorText = sqlite3_errstr(SQLITE_INTERRUPT);
+    }
+    else if (isConnected())
+    {
+        output.connected = true;
+        bool implicitTransaction = sqlite3_get_autocommit(connection);
+        sqlite3_stmt* statement = statementCache.take(query);
+
+        if (statement != nullptr || sqlite3_prepare_v2(connection, query.c_str(), -1, &statement, nullptr) == SQLITE_OK)
+        {
+            if (implicitTransaction &&
+                sqlite3_exec(connection, "begin transaction;", nullptr, nullptr, nullptr) != SQLITE_OK)
+            {
+                output.errorText = sqlite3_errmsg(connection);
+                implicitTransaction = false;
+            }
+            timer.lap(metrics.prepare);
+
+            for (size_t row=0; statement != nullptr && output.errorText.empty() && row<parameterRows.size(); row++)
+            {
+                const int parameterCount = sqlite3_bind_parameter_count(statement);
+                for (int x=0; x<parameterCount && x<parameterRows[row].size(); x++)
+                    bindParameter(statement, x+1, parameterRows[row][x]);
+
+                const int stepResult = sqlite3_step(statement);
+                if (stepResult == SQLITE_DONE || stepResult == SQLITE_ROW)
+                    output.rowsEffected += sqlite3_changes(connection);
+                else
+                    output.errorText = sqlite3_errmsg(connection);
+
+                sqlite3_reset(statement);
+                sqlite3_clear_bindings(statement);
+            }
+
+            if (implicitTransaction)
+            {
+                if (output.errorText.empty())
+                {
+                    if (sqlite3_exec(connection, "commit transaction;", nullptr, nullptr, nullptr) != SQLITE_OK)
+                        output.errorText = sqlite3_errmsg(connection);
+                }
+                if (!output.errorText.empty())
+                {
+                    metaDataCache.invalidate();
+                    sqlite3_exec(connection, "rollback transaction;", nullptr, nullptr, nullptr);
+                    output.rowsEffected = 0;
+                }
+            }
+
+            if (statement != nullptr)
+            {
+                if (isSchemaChange(query))
+                {
+                    statementCache.clear();
+                    sqlite3_finalize(statement);
+                }
+                else if (output.errorText.empty())
+                {
+                    statementCache.give(query, statement);
+                }
+                else
+                {
+                    sqlite3_finalize(statement);
+                }
+            }
+            timer.lap(metrics.execute);
+        }
+        else
+        {
+            output.errorText = sqlite3_errmsg(connection);
+            timer.lap(metrics.prepare);
+        }
+
+        if (instrumentation.isEnabled())
+        {
+            output.metrics = metrics;
+            instrumentation.record(output.performedQueries.front(), metrics);
+        }
+    }
+
+    return output;
 }
 
 Result<TableDefinitions> SqliteConnection::getMetaData()
@@ -113,7 +442,7 @@ Result<TableDefinitions> SqliteConnection::getMetaData()
         const auto dbConnection = connection;
         sqlite3_stmt* statement = nullptr;
 
-        if (sqlite3_prepare(dbConnection, getAllTableInfo.c_str(), -1, &statement, nullptr) == SQLITE_OK)
+        if (sqlite3_prepare_v2(dbConnection, getAllTableInfo.c_str(), -1, &statement, nullptr) == SQLITE_OK)
         {
             forEachTable([&output, statement, getAllTableInfo](const string& table)
             {
@@ -141,59 +470,61 @@ Result<TableDefinitions> SqliteConnection::getMetaData()
     return output;
 }
 
-unordered_set<string> SqliteConnection::validate(TableDefinitions tableDefinitions, bool strict)
+Result<TableDefinitions> SqliteConnection::getMetaData(size_t workers)
 {
-    unordered_set<string> output;
-    Result<TableDefinitions> metaData = getMetaData();
+    // sqlite keeps the schema in memory once it has been read, so asking other connections for it only adds work
+    return getMetaData();
+}
 
-    if (!metaData.connected) output.emplace("Database not connected " + connectionString);
-    if (!metaData.errorText.empty()) output.emplace(metaData.errorText);
+Result<void*> SqliteConnection::refreshMetaDataCache()
+{
+    // sqlite adds one to the schema version every time the structure of the database changes, no matter which
+    // connection changed it, so the cache is current for as long as the version stays the same
+    const string getSchemaVersion = "pragma schema_version;";
+    const string getAllColumns = "select tables.tbl_name, columns.name, columns.type from sqlite_schema as tables "
+                                 "join pragma_table_info(tables.tbl_name) as columns where tables.type = 'table';";
+    string version;
+
+    Result<void*> output = executeStatement({getSchemaVersion, {}}, [&version](sqlite3_stmt* statement)
+    {
+        version = (char*)sqlite3_column_text(statement, 0);
+        return true;
+    });
 
-    if (output.empty())
+    if (output.errorText.empty() && !metaDataCache.isCurrent(version))
     {
-        if (strict)
+        TableDefinitions definitions;
+        const Result<void*> columns = executeStatement({getAllColumns, {}}, [&definitions](sqlite3_stmt* statement)
         {
-            for (auto const&[tableName, columnData] : metaData.data)
-            {
-                if (tableDefinitions.contains(tableName))
-                {
-                    for (auto const&[columnName, columnType] : columnData)
-                    {
-                        if (!tableDefinitions[tableName].contains(columnName))
-                            output.emplace("Unwanted column " + columnName + " in table " + tableName);
-                    }
-                }
-                else
-                {
-                    output.emplace("Unwanted table " + tableName);
-                }
-            }
-        }
+            definitions[(char*)sqlite3_column_text(statement, 0)][(char*)sqlite3_column_text(statement, 1)] =
+                string((char*)sqlite3_column_text(statement, 2), sqlite3_column_bytes(statement, 2));
+            return true;
+        });
+
+        output.errorText = columns.errorText;
+        output.performedQueries.emplace_back(columns.performedQueries.front());
+        if (columns.errorText.empty()) metaDataCache.store(version, std::move(definitions));
+    }
 
-        for (auto const&[tableName, columnData] : tableDefinitions)
-        {
-            if (metaData.data.contains(tableName))
-            {
-                for (auto const&[columnName, columnType] : columnData)
-                {
-                    if (metaData.data[tableName].contains(columnName))
-                    {
-                        if(metaData.data[tableName][columnName] != columnType)
-                            output.emplace("Column " + columnName + " in table " + tableName +
-                                " is the wrong type; expected: " + columnType + " actual: " +
-                                metaData.data[tableName][columnName]);
-                    }
-                    else
-                    {
-                        output.emplace("Missing column in " + tableName + ": " + columnName);
-                    }
-                }
-            }
-            else
-            {
-                output.emplace("Missing table " + tableName);
-            }
-        }
+    return output;
+}
+
+unordered_set<string> SqliteConnection::validate(const TableDefinitions& tableDefinitions, bool strict)
+{
+    unordered_set<string> output;
+
+    if (isConnected())
+    {
+        const Result<void*> status = refreshMetaDataCache();
+
+        if (status.errorText.empty())
+            output = compareTableDefinitions(tableDefinitions, metaDataCache.getDefinitions(), strict);
+        else
+            output.emplace(status.errorText);
+    }
+    else
+    {
+        output.emplace("Database not connected " + connectionString);
     }
 
     return output;
@@ -207,68 +538,245 @@ Result<QueryReturnData> SqliteConnection::performQuery(string query)
 
 Result<QueryReturnData> SqliteConnection::performQuery(StructuredQuery structuredQuery)
 {
-    Result<QueryReturnData> output = {false, 0, "", {structuredQuery}, {}};
+    QueryReturnData data;
+    const Result<void*> status = executeStatement(structuredQuery, [&data](sqlite3_stmt* statement)
+    {
+        int columns = sqlite3_data_count(statement);
+        data.emplace_back();
+        for (int z=0; z<columns; z++)
+        {
+            string columnValue =
+                string((char*)sqlite3_column_text(statement, z), sqlite3_column_bytes(statement, z));
+            data[data.size() - 1][(char*)sqlite3_column_name(statement, z)] = columnValue;
+        }
+        return true;
+    });
 
-    if (isConnected())
+    return {status.connected, status.rowsEffected, status.errorText, status.performedQueries, data, status.metrics};
+}
+
+Result<ResultTable> SqliteConnection::performTableQuery(string query)
+{
+    return performTableQuery(StructuredQuery{query, {}});
+}
+
+Result<ResultTable> SqliteConnection::performTableQuery(const StructuredQuery& query)
+{
+    ResultTable data;
+    const Result<void*> status = executeStatement(query, [&data](sqlite3_stmt* statement)
+    {
+        appendRow(data, statement);
+        return true;
+    }, [&data](sqlite3_stmt* statement) { readColumns(data, statement); });
+
+    return {status.connected, status.rowsEffected, status.errorText, status.performedQueries, data, status.metrics};
+}
+
+Result<void*> SqliteConnection::executeStatement(const StructuredQuery& structuredQuery,
+                                                 const function<bool(sqlite3_stmt*)>& onRow,
+                                                 const function<void(sqlite3_stmt*)>& onColumns)
+{
+    Result<void*> output = {false, 0, "", {structuredQuery}, nullptr};
+    const bool instrumented = instrumentation.isEnabled();
+    QueryMetrics metrics;
+    QueryTimer timer(instrumented);
+
+    if (isConnected() && interrupted)
+    {
+        // a short statement can finish before the progress handler is ever called, so the flag is checked up front
+        output.connected = true;
+        output.errorText = sqlite3_errstr(SQLITE_INTERRUPT);
+    }
+    else if (isConnected())
     {
         output.connected = true;
         auto dbConnection = connection;
-        sqlite3_stmt* statement = nullptr;
+        sqlite3_stmt* statement = statementCache.take(structuredQuery.query);
+
+        // Rolling back a change to the structure takes the schema version back down, so a version that was cached
+        // inside the transaction could later be reused by a different change.
+        if (isRollback(structuredQuery.query)) metaDataCache.invalidate();
 
         if (
-            sqlite3_prepare(dbConnection, structuredQuery.query.c_str(), -1, &statement, nullptr) ==
-            SQLITE_OK
+            statement != nullptr ||
+            sqlite3_prepare_v2(dbConnection, structuredQuery.query.c_str(), -1, &statement, nullptr) == SQLITE_OK
            )
         {
-            for (int x=0; x<structuredQuery.parameters.size(); x++)
-                sqlite3_bind_text(statement, x+1, structuredQuery.parameters[x].c_str(),
-                    structuredQuery.parameters[x].size(), SQLITE_STATIC);
-
-            while (sqlite3_step(statement) == SQLITE_ROW)
+            if (statement != nullptr)
             {
-                int columns = sqlite3_data_count(statement);
-                output.data.emplace_back();
-                for (int z=0; z<columns; z++)
+                int stepResult;
+                bool keepGoing = true;
+
+                for (int x=0; x<structuredQuery.parameters.size(); x++)
+                    sqlite3_bind_text(statement, x+1, structuredQuery.parameters[x].c_str(),
+                        structuredQuery.parameters[x].size(), SQLITE_STATIC);
+                timer.lap(metrics.prepare);
+
+                while (keepGoing && (stepResult = sqlite3_step(statement)) == SQLITE_ROW)
                 {
-                    string columnValue =
-                        string((char*)sqlite3_column_text(statement, z), sqlite3_column_bytes(statement, z));
-                    output.data[output.data.size() - 1][(char*)sqlite3_column_name(statement, z)] = columnValue;
+                    // the first step is where sqlite runs the statement, every step after that reads another row
+                    timer.lap(metrics.rows == 0 ? metrics.execute : metrics.fetch);
+                    // a cached statement is compiled again inside the first step if the schema changed, so the columns
+                    // are only read once it has run
+                    if (metrics.rows == 0 && onColumns) onColumns(statement);
+                    metrics.rows++;
+                    if (instrumented) metrics.bytes += getRowBytes(statement);
+                    keepGoing = onRow(statement);
+                    timer.lap(metrics.materialize);
                 }
-            }
+                timer.lap(metrics.rows == 0 ? metrics.execute : metrics.fetch);
+                if (metrics.rows == 0 && stepResult == SQLITE_DONE && onColumns) onColumns(statement);
+
+                if (stepResult != SQLITE_DONE && stepResult != SQLITE_ROW)
+                    output.errorText = sqlite3_errmsg(dbConnection);
+                output.rowsEffected = sqlite3_changes(dbConnection);
+                sqlite3_reset(statement);
+                sqlite3_clear_bindings(statement);
 
-            if (sqlite3_finalize(statement) != SQLITE_OK) output.errorText = sqlite3_errmsg(dbConnection);
-            output.rowsEffected = sqlite3_changes(dbConnection);
+                if (isSchemaChange(structuredQuery.query))
+                {
+                    statementCache.clear();
+                    sqlite3_finalize(statement);
+                }
+                else if (output.errorText.empty())
+                {
+                    statementCache.give(structuredQuery.query, statement);
+                }
+                else
+                {
+                    sqlite3_finalize(statement);
+                }
+            }
         }
         else
         {
             output.errorText = sqlite3_errmsg(dbConnection);
+            timer.lap(metrics.prepare);
+        }
+
+        if (instrumented)
+        {
+            output.metrics = metrics;
+            instrumentation.record(structuredQuery, metrics);
         }
     }
 
     return output;
 }
 
-Result<MultiTableData> SqliteConnection::getAllData()
+Result<void*> SqliteConnection::streamQuery(const StructuredQuery& query,
+                                           const function<bool(const ResultTable::RowView&)>& visitor)
 {
-    Result<MultiTableData> output = {false, 0, "", {}, {}};
+    ResultTable row;
+    return executeStatement(query, [&row, &visitor](sqlite3_stmt* statement)
+    {
+        row.clearRows();
+        appendRow(row, statement);
+        return visitor(row[0]);
+    }, [&row](sqlite3_stmt* statement) { readColumns(row, statement); });
+}
+
+Result<void*> SqliteConnection::streamAllData(const function<bool(const string&, const ResultTable&)>& sink,
+                                             size_t batchSize)
+{
+    Result<void*> output = {false, 0, "", {}, nullptr};
 
     if (isConnected())
     {
         output.connected = true;
-        forEachTable([&output, this](const string& table)
+        bool keepGoing = true;
+        forEachTable([&output, &keepGoing, &sink, batchSize, this](const string& table)
         {
-            auto tableData = this->performQuery("select * from " + table + ";");
-            output.data[table] = tableData.data;
-            if (!output.errorText.empty()) output.errorText += " ";
-            output.errorText += tableData.errorText;
-            if(!tableData.performedQueries.empty())
-                output.performedQueries.emplace_back(tableData.performedQueries.front());
+            if (keepGoing)
+            {
+                ResultTable batch;
+                bool sentBatch = false;
+                auto tableData = executeStatement({"select * from " + table + ";", {}},
+                    [&batch, &keepGoing, &sentBatch, &sink, &table, batchSize](sqlite3_stmt* statement)
+                    {
+                        appendRow(batch, statement);
+                        if (batch.getRowCount() >= batchSize)
+                        {
+                            keepGoing = sink(table, batch);
+                            sentBatch = true;
+                            batch.clearRows();
+                        }
+                        return keepGoing;
+                    }, [&batch](sqlite3_stmt* statement) { readColumns(batch, statement); });
+
+                if (keepGoing && (batch.getRowCount() > 0 || !sentBatch)) keepGoing = sink(table, batch);
+                if (!output.errorText.empty()) output.errorText += " ";
+                output.errorText += tableData.errorText;
+                if(!tableData.performedQueries.empty())
+                    output.performedQueries.emplace_back(tableData.performedQueries.front());
+                if (tableData.metrics)
+                {
+                    if (!output.metrics) output.metrics.emplace();
+                    *output.metrics += *tableData.metrics;
+                }
+            }
         }, output.performedQueries);
     }
 
     return output;
 }
 
+Result<MultiTableData> SqliteConnection::getAllData()
+{
+    MultiTableData data;
+    const Result<void*> status = streamAllData([&data](const string& table, const ResultTable& rows)
+    {
+        QueryReturnData& tableData = data[table];
+        for (Row& row : rows.toQueryReturnData()) tableData.emplace_back(std::move(row));
+        return true;
+    });
+
+    return {status.connected, status.rowsEffected, status.errorText, status.performedQueries, data, status.metrics};
+}
+
+Result<MultiTableData> SqliteConnection::getAllData(size_t workers)
+{
+    Result<MultiTableData> output = {true, 0, "", {}, {}};
+    vector<string> tables;
+    vector<Result<QueryReturnData>> tableData;
+
+    const bool parallel = readTablesInParallel(workers, output.performedQueries,
+        [&tables, &tableData](const vector<string>& tableNames)
+        {
+            tables = tableNames;
+            tableData.resize(tables.size());
+        },
+        [&tables, &tableData, instrumented = instrumentation.isEnabled()](SqliteConnection& worker, size_t table)
+        {
+            // workers time their own queries, the timings are recorded here once everyone is done
+            if (instrumented) worker.enableInstrumentation();
+            else worker.disableInstrumentation();
+
+            // the rows are converted here so that the conversion is spread over the workers too
+            const auto rows = worker.performTableQuery("select * from " + tables[table] + ";");
+            tableData[table] = {rows.connected, rows.rowsEffected, rows.errorText, rows.performedQueries,
+                rows.data.toQueryReturnData(), rows.metrics};
+        });
+
+    if (!parallel) return getAllData();
+
+    for (size_t x=0; x<tables.size(); x++)
+    {
+        output.data[tables[x]] = std::move(tableData[x].data);
+        if (!output.errorText.empty()) output.errorText += " ";
+        output.errorText += tableData[x].errorText;
+        output.performedQueries.emplace_back(tableData[x].performedQueries.front());
+        if (tableData[x].metrics)
+        {
+            instrumentation.record(tableData[x].performedQueries.front(), *tableData[x].metrics);
+            if (!output.metrics) output.metrics.emplace();
+            *output.metrics += *tableData[x].metrics;
+        }
+    }
+
+    return output;
+}
+
 bool SqliteConnection::isConnected()
 {
     return connection != nullptr;
@@ -277,4 +785,55 @@ bool SqliteConnection::isConnected()
 std::string SqliteConnection::getConnectionString()
 {
     return connectionString;
+}
+
+void SqliteConnection::setStatementCacheSize(size_t size)
+{
+    statementCache.setCapacity(size);
+}
+
+void SqliteConnection::clearStatementCache()
+{
+    statementCache.clear();
+}
+
+StatementCacheStatistics SqliteConnection::getStatementCacheStatistics()
+{
+    return statementCache.getStatistics();
+}
+
+void SqliteConnection::enableInstrumentation(chrono::nanoseconds slowQueryThreshold,
+    const function<void(const StructuredQuery&, const QueryMetrics&)>& onSlowQuery)
+{
+    instrumentation.enable(slowQueryThreshold, onSlowQuery);
+}
+
+void SqliteConnection::disableInstrumentation()
+{
+    instrumentation.disable();
+}
+
+unordered_map<string, LatencyHistogram> SqliteConnection::getLatencyHistograms()
+{
+    return instrumentation.getHistograms();
+}
+
+void SqliteConnection::clearLatencyHistograms()
+{
+    instrumentation.clearHistograms();
+}
+
+void SqliteConnection::interrupt()
+{
+    interrupted = true;
+}
+
+void SqliteConnection::clearInterrupt()
+{
+    interrupted = false;
+}
+
+const SqliteConnection::Options& SqliteConnection::getOptions() const
+{
+    return options;
 }
\ No newline at end of file
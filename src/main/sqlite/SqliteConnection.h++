@@ -1,16 +1,26 @@
 #ifndef StiltFox_UniversalLibrary_SqliteConnection
 #define StiltFox_UniversalLibrary_SqliteConnection
 #include <string>
+#include <chrono>
+#include <memory>
+#include <atomic>
 #include <functional>
 #include <sqlite3.h>
 
 #include "DatabaseConnection.h++"
+#include "StatementCache.h++"
+#include "ConnectionPool.h++"
+#include "QueryInstrumentation.h++"
+#include "MetaDataCache.h++"
 
 namespace StiltFox::StorageShed
 {
     /*******************************************************************************************************************
      * This class is an SQLite implementation of DatabaseConnection.
      *
+     * Every getAllData(workers) worker reads the same snapshot. In write ahead log mode other connections only wait to
+     * write while the workers open their snapshots, in the other journal modes they wait until the workers are done.
+     *
      * This class will disconnect and delete its connection pointer whenever it leaves scope. If you wish to use this
      * connection in multiple places, consider a few options:
      * 1) Pass around a shared pointer.
@@ -18,19 +28,92 @@ namespace StiltFox::StorageShed
      * 2) Copy the class to a new object
      *       - the copy constructor copies the connection string, but not the connection itself, allowing the copy to
      *         manage its own connection.
+     * 3) Use a ConnectionPool
+     *       - this will allow multiple threads to share a set of connections. See getPoolOptions.
      ******************************************************************************************************************/
     class SqliteConnection : public DatabaseConnection
     {
+        public:
+        /***************************************************************************************************************
+         * These are the settings used when a connection is opened. The defaults open an existing database for reading
+         * and writing with foreign keys turned on, and leave everything else as sqlite would. Pragmas that are left
+         * empty or at 0 are not sent at all.
+         *
+         * The named profiles are starting points that can be changed before they are used.
+         **************************************************************************************************************/
+        struct Options
+        {
+            // open the database with SQLITE_OPEN_READONLY. Any attempt to write returns an error.
+            bool readOnly = false;
+            // create the database file if it does not exist yet
+            bool create = false;
+            // open with SQLITE_OPEN_NOMUTEX. This is safe as long as the connection is only used by one thread at a
+            // time, which is already the case for connections that come from a ConnectionPool or an AsyncConnection.
+            bool noMutex = false;
+            // open with SQLITE_OPEN_SHAREDCACHE, so connections in the same process share one page cache
+            bool sharedCache = false;
+            bool foreignKeys = true;
+            // how long to wait for a lock held by another connection before returning SQLITE_BUSY
+            std::chrono::milliseconds busyTimeout = std::chrono::milliseconds::zero();
+            // the value of PRAGMA journal_mode, for example WAL, MEMORY or DELETE
+            std::string journalMode;
+            // the value of PRAGMA synchronous, for example FULL, NORMAL or OFF
+            std::string synchronous;
+            // the value of PRAGMA temp_store, for example MEMORY or FILE
+            std::string tempStore;
+            // the value of PRAGMA cache_size. Positive numbers are pages, negative numbers are KiB.
+            int64_t cacheSize = 0;
+            // the value of PRAGMA mmap_size, the number of bytes of the file to read through memory mapped io
+            int64_t mmapSize = 0;
+
+            /***********************************************************************************************************
+             * This profile is for databases that are mostly read. Reads go through a 256MiB memory map instead of read
+             * calls, and the page cache is raised to 64MiB.
+             **********************************************************************************************************/
+            static Options readHeavy();
+            /***********************************************************************************************************
+             * This profile is for databases with a lot of writes. Write ahead logging lets readers carry on during a
+             * write, and synchronous=NORMAL only syncs the log at checkpoints. A committed transaction can be lost if
+             * the machine loses power, but the database can not be corrupted. Writers wait up to 5 seconds for a lock.
+             **********************************************************************************************************/
+            static Options writeHeavy();
+            /***********************************************************************************************************
+             * This profile is for scratch databases where nothing has to survive a crash, such as :memory: databases
+             * or temporary files. The journal is kept in memory and nothing is ever synced to disk. The database is
+             * created if it does not exist.
+             **********************************************************************************************************/
+            static Options inMemory();
+        };
+
+        private:
         sqlite3* connection = nullptr;
         std::string connectionString;
+        Options options;
+        StatementCache<sqlite3_stmt*> statementCache = {[](sqlite3_stmt* statement){sqlite3_finalize(statement);}};
+        std::unique_ptr<ConnectionPool<SqliteConnection>> workerPool;
+        QueryInstrumentation instrumentation;
+        MetaDataCache metaDataCache;
+        // set by interrupt, and checked by sqlite through a progress handler while a statement runs
+        std::atomic<bool> interrupted = false;
 
-        bool checkIfValidSqlDatabase() const;
+        Data::Result<void*> refreshMetaDataCache();
+        Data::Result<void*> executeStatement(const Data::StructuredQuery& query,
+                                             const std::function<bool(sqlite3_stmt*)>& onRow,
+                                             const std::function<void(sqlite3_stmt*)>& onColumns = {});
         void forEachTable(const std::function<void(std::string)>&, std::vector<Data::StructuredQuery>& queryTracker)
                                                                                                                   const;
+        bool readTablesInParallel(size_t workers, std::vector<Data::StructuredQuery>& queryTracker,
+                                  const std::function<void(const std::vector<std::string>& tables)>& onTables,
+                                  const std::function<void(SqliteConnection& worker, size_t table)>& readTable);
 
         public:
         SqliteConnection(const std::string& connection);
         SqliteConnection(const char* connection);
+        /***************************************************************************************************************
+         * @param connection - the path to the Sqlite file that you wish to connect to.
+         * @param options - the settings to use every time this connection is opened.
+         **************************************************************************************************************/
+        SqliteConnection(const std::string& connection, const Options& options);
         SqliteConnection(const SqliteConnection& toCopy);
 
         // For information on this block of functions, see DatabaseConnection.h++
@@ -41,18 +124,41 @@ namespace StiltFox::StorageShed
         Data::Result<void*> commitTransaction() override;
         Data::Result<void*> performUpdate(std::string statement) override;
         Data::Result<void*> performUpdate(const Data::StructuredQuery& statement) override;
-        std::unordered_set<std::string> validate(Data::TableDefinitions tableDefinitions, bool strict) override;
+        Data::Result<void*> executeBatch(const std::string& query,
+            const std::vector<Data::ParameterRow>& parameterRows) override;
+        std::unordered_set<std::string> validate(const Data::TableDefinitions& tableDefinitions, bool strict) override;
         Data::Result<Data::TableDefinitions> getMetaData() override;
+        // sqlite keeps the schema in memory, so this reads serially on this connection and ignores workers
+        Data::Result<Data::TableDefinitions> getMetaData(size_t workers) override;
         Data::Result<Data::QueryReturnData> performQuery(std::string query) override;
         Data::Result<Data::QueryReturnData> performQuery(Data::StructuredQuery query) override;
+        Data::Result<Data::ResultTable> performTableQuery(std::string query) override;
+        Data::Result<Data::ResultTable> performTableQuery(const Data::StructuredQuery& query) override;
         Data::Result<Data::MultiTableData> getAllData() override;
+        Data::Result<Data::MultiTableData> getAllData(size_t workers) override;
+        Data::Result<void*> streamQuery(const Data::StructuredQuery& query,
+            const std::function<bool(const Data::ResultTable::RowView&)>& visitor) override;
+        Data::Result<void*> streamAllData(
+            const std::function<bool(const std::string& table, const Data::ResultTable& rows)>& sink,
+            size_t batchSize = 1000) override;
         bool isConnected() override;
         std::string getConnectionString() override;
+        void setStatementCacheSize(size_t size) override;
+        void clearStatementCache() override;
+        Data::StatementCacheStatistics getStatementCacheStatistics() override;
+        void enableInstrumentation(std::chrono::nanoseconds slowQueryThreshold = std::chrono::nanoseconds::max(),
+            const std::function<void(const Data::StructuredQuery&, const Data::QueryMetrics&)>& onSlowQuery = {})
+            override;
+        void disableInstrumentation() override;
+        std::unordered_map<std::string, Data::LatencyHistogram> getLatencyHistograms() override;
+        void clearLatencyHistograms() override;
+        void interrupt() override;
+        void clearInterrupt() override;
         // end override section
 
         /***************************************************************************************************************
          * This operator makes it possible to assign a connection string directly to an SqliteConnection. This is like
-         * calling the constructor that accepts a std::string.
+         * calling the constructor that accepts a std::string, except that the current options are kept.
          *
          * @param connection - the path to the Sqlite file that you wish to connect to.
          *
@@ -60,6 +166,22 @@ namespace StiltFox::StorageShed
          **************************************************************************************************************/
         SqliteConnection& operator=(const std::string& connection);
         ~SqliteConnection();
+
+        const Options& getOptions() const;
+
+        /***************************************************************************************************************
+         * This function returns the settings a ConnectionPool of SqliteConnections should use. Every pooled connection
+         * is switched to write ahead logging, so any number of readers can work alongside a writer. Sqlite only allows
+         * one writer at a time, so the pool will only hand out one ConnectionAccess::Write lease at a time, and
+         * connections will wait up to busyTimeout for a lock instead of failing straight away.
+         *
+         * @param maximumSize - the largest number of connections the pool will open.
+         * @param busyTimeout - how long a connection waits on a locked database before returning an error.
+         *
+         * @return the options to pass to the ConnectionPool constructor.
+         **************************************************************************************************************/
+        static ConnectionPoolOptions<SqliteConnection> getPoolOptions(size_t maximumSize = 8,
+            std::chrono::milliseconds busyTimeout = std::chrono::seconds(5));
     };
 }
 
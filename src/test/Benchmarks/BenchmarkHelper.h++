@@ -0,0 +1,46 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#ifndef Stilt_Fox_8e2c4a6f1b3d4f9e8a7c5b3d1f0e2a4c
+#define Stilt_Fox_8e2c4a6f1b3d4f9e8a7c5b3d1f0e2a4c
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <functional>
+
+/***********************************************************************************************************************
+ * The benchmarks are written as gtest cases so that they can use the same runners, fixtures and filters as the unit
+ * tests. They do not assert on timing, they only print how long each scenario took.
+ *
+ * environment variables:
+ * STILT_FOX_BENCHMARK_SCALE: multiplies the number of operations each benchmark performs. It defaults to 1.
+ **********************************************************************************************************************/
+namespace StiltFox::StorageShed::Benchmarks
+{
+    inline size_t scaled(size_t operations)
+    {
+        const char* scale = getenv("STILT_FOX_BENCHMARK_SCALE");
+        return scale == nullptr ? operations : operations * std::stoul(scale);
+    }
+
+    inline std::chrono::nanoseconds timeAction(const std::function<void()>& action)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        action();
+        return std::chrono::steady_clock::now() - start;
+    }
+
+    inline void report(const std::string& name, size_t operations, std::chrono::nanoseconds elapsed)
+    {
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        std::cout << "[ BENCHMARK] " << name << ": " << operations << " operations in " << seconds * 1000 << " ms ("
+            << (seconds > 0 ? operations / seconds : 0) << " ops/sec)" << std::endl;
+    }
+}
+
+#endif
\ No newline at end of file
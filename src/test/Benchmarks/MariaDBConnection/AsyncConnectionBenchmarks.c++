@@ -0,0 +1,74 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <deque>
+#include <future>
+#include <gtest/gtest.h>
+#include "BenchmarkHelper.h++"
+#include "AsyncConnection.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+using namespace StiltFox::StorageShed::Tests::MariaDB_Connection;
+
+namespace StiltFox::StorageShed::Benchmarks::MariaDB_Connection::Async_Connection
+{
+    const size_t connectionCount = 8, inFlight = 64;
+    const string selectQuery = "select id, name from test.table1 where id = ?";
+
+    class asyncConnection : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(asyncConnection, many_queries_in_flight_compared_to_blocking_calls_from_one_thread)
+    {
+        const size_t operations = scaled(5000);
+        MariaDBConnection blocking = connectionInformation;
+        blocking.connect();
+
+        const auto blockingElapsed = timeAction([&blocking, operations]()
+        {
+            for (size_t x=0; x<operations; x++)
+                blocking.performTableQuery(StructuredQuery{selectQuery, {to_string(x % 3 + 1)}});
+        });
+        report("blocking queries from one thread", operations, blockingElapsed);
+
+        vector<unique_ptr<AsyncConnection<MariaDBConnection>>> connections;
+        for (size_t x=0; x<connectionCount; x++)
+            connections.emplace_back(make_unique<AsyncConnection<MariaDBConnection>>(connectionInformation));
+        const auto asyncElapsed = timeAction([&connections, operations]()
+        {
+            // the submitting thread keeps up to inFlight queries outstanding, the way an event loop would
+            deque<future<Result<ResultTable>>> pending;
+            for (size_t x=0; x<operations; x++)
+            {
+                if (pending.size() >= inFlight)
+                {
+                    pending.front().get();
+                    pending.pop_front();
+                }
+                pending.emplace_back(connections[x % connectionCount]->performTableQueryAsync(
+                    {selectQuery, {to_string(x % 3 + 1)}}));
+            }
+            for (auto& result : pending) result.get();
+        });
+        report("async queries over 8 connections with 64 in flight", operations, asyncElapsed);
+    }
+}
\ No newline at end of file
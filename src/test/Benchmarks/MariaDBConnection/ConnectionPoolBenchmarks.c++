@@ -0,0 +1,79 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <thread>
+#include <gtest/gtest.h>
+#include "BenchmarkHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+using namespace StiltFox::StorageShed::Tests::MariaDB_Connection;
+
+namespace StiltFox::StorageShed::Benchmarks::MariaDB_Connection::Connection_Pool
+{
+    const size_t threadCount = 8;
+    const string selectQuery = "select id, name from test.table1 where id = ?";
+
+    class connectionPool : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+
+        static chrono::nanoseconds runOnThreads(size_t operationsPerThread, const function<void(size_t)>& operation)
+        {
+            return timeAction([operationsPerThread, &operation]()
+            {
+                vector<thread> threads;
+                for (size_t x=0; x<threadCount; x++)
+                    threads.emplace_back([operationsPerThread, &operation]()
+                    {
+                        for (size_t y=0; y<operationsPerThread; y++) operation(y);
+                    });
+                for (auto& thread : threads) thread.join();
+            });
+        }
+    };
+
+    TEST_F(connectionPool, pooled_connections_compared_to_a_new_connection_per_request)
+    {
+        const size_t operationsPerThread = scaled(200);
+
+        const auto newConnectionElapsed = runOnThreads(operationsPerThread, [this](size_t x)
+        {
+            MariaDBConnection connection = connectionInformation;
+            connection.connect();
+            connection.performQuery(StructuredQuery{selectQuery, {to_string(x % 3 + 1)}});
+        });
+        report("new connection per request on 8 threads", operationsPerThread * threadCount, newConnectionElapsed);
+
+        ConnectionPoolOptions<MariaDBConnection> options;
+        options.maximumSize = threadCount;
+        ConnectionPool<MariaDBConnection> pool(connectionInformation, options);
+        const auto pooledElapsed = runOnThreads(operationsPerThread, [&pool](size_t x)
+        {
+            pool.acquire()->performQuery(StructuredQuery{selectQuery, {to_string(x % 3 + 1)}});
+        });
+        report("pooled connection per request on 8 threads", operationsPerThread * threadCount, pooledElapsed);
+
+        const auto statistics = pool.getStatistics();
+        cout << "[ BENCHMARK]     average wait "
+            << chrono::duration<double, micro>(statistics.totalWaitTime).count() / statistics.acquisitions
+            << " us, utilization " << statistics.utilization * 100 << "%, connections opened "
+            << statistics.connectionsOpened << endl;
+    }
+}
\ No newline at end of file
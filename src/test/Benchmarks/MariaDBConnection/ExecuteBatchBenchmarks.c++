@@ -0,0 +1,61 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "BenchmarkHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+using namespace StiltFox::StorageShed::Tests::MariaDB_Connection;
+
+namespace StiltFox::StorageShed::Benchmarks::MariaDB_Connection::Execute_Batch
+{
+    const string insertQuery = "insert into test.table2 (id_1, id_2) values (?, ?)";
+
+    class executeBatch : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(executeBatch, bulk_insert_compared_to_a_row_at_a_time)
+    {
+        const size_t rows = scaled(1000000);
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        const auto rowAtATimeElapsed = timeAction([&connection, rows]()
+        {
+            connection.startTransaction();
+            for (size_t x=0; x<rows; x++)
+                connection.performUpdate(StructuredQuery{insertQuery, {to_string(x), to_string(x + 1)}});
+            connection.commitTransaction();
+        });
+        report("insert one row at a time in a transaction", rows, rowAtATimeElapsed);
+        connection.performUpdate("delete from test.table2");
+
+        vector<ParameterRow> parameters;
+        parameters.reserve(rows);
+        for (size_t x=0; x<rows; x++) parameters.push_back({(int64_t)x, (int64_t)x + 1});
+        const auto batchElapsed = timeAction([&connection, &parameters]()
+        {
+            connection.executeBatch(insertQuery, parameters);
+        });
+        report("insert with executeBatch", rows, batchElapsed);
+    }
+}
\ No newline at end of file
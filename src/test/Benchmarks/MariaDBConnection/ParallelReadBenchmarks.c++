@@ -0,0 +1,60 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "BenchmarkHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+using namespace StiltFox::StorageShed::Tests::MariaDB_Connection;
+
+namespace StiltFox::StorageShed::Benchmarks::MariaDB_Connection::Parallel_Read
+{
+    const size_t tableCount = 32;
+
+    class parallelRead : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(parallelRead, getAllData_with_workers_compared_to_one_table_at_a_time)
+    {
+        const size_t rowsPerTable = scaled(2000);
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        for (size_t x=0; x<tableCount; x++)
+        {
+            const string table = "test.bench" + to_string(x);
+            connection.performUpdate("create table " + table + " (id int primary key, name varchar(255))");
+            vector<ParameterRow> rows;
+            for (size_t y=0; y<rowsPerTable; y++) rows.push_back({(int64_t)y, "row " + to_string(y)});
+            connection.executeBatch("insert into " + table + " (id, name) values (?, ?)", rows);
+        }
+
+        for (const size_t workers : {(size_t)1, (size_t)2, (size_t)4, (size_t)8})
+        {
+            const auto elapsed = timeAction([&connection, workers]()
+            {
+                connection.getAllData(workers);
+            });
+            report("getAllData of " + to_string(tableCount) + " tables with " + to_string(workers) + " workers",
+                tableCount * rowsPerTable, elapsed);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "BenchmarkHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+using namespace StiltFox::StorageShed::Tests::MariaDB_Connection;
+
+namespace StiltFox::StorageShed::Benchmarks::MariaDB_Connection::Statement_Cache
+{
+    class statementCache : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+
+        void compareCacheOnAndOff(const string& name, const function<void(MariaDBConnection&, size_t)>& scenario)
+        {
+            const size_t operations = scaled(10000);
+
+            for (const size_t cacheSize : {(size_t)0, (size_t)64})
+            {
+                MariaDBConnection connection = connectionInformation;
+                connection.connect();
+                connection.setStatementCacheSize(cacheSize);
+
+                const auto elapsed = timeAction([&connection, &scenario, operations]()
+                {
+                    scenario(connection, operations);
+                });
+                report(name + (cacheSize == 0 ? " (cache off)" : " (cache on)"), operations, elapsed);
+            }
+        }
+    };
+
+    TEST_F(statementCache, repeated_parameterized_select)
+    {
+        compareCacheOnAndOff("repeated parameterized select", [](MariaDBConnection& connection, size_t operations)
+        {
+            for (size_t x=0; x<operations; x++)
+                connection.performQuery(StructuredQuery{"select id, name from test.table1 where id = ?",
+                    {to_string(x % 3 + 1)}});
+        });
+    }
+
+    TEST_F(statementCache, repeated_parameterized_insert)
+    {
+        compareCacheOnAndOff("repeated parameterized insert", [](MariaDBConnection& connection, size_t operations)
+        {
+            connection.startTransaction();
+            for (size_t x=0; x<operations; x++)
+                connection.performUpdate(StructuredQuery{"insert into test.table2 (id_1, id_2) values (?, ?)",
+                    {to_string(x), to_string(x + 1)}});
+            connection.commitTransaction();
+        });
+    }
+}
\ No newline at end of file
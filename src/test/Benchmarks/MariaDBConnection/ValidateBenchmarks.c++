@@ -0,0 +1,70 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "BenchmarkHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+using namespace StiltFox::StorageShed::Tests::MariaDB_Connection;
+
+namespace StiltFox::StorageShed::Benchmarks::MariaDB_Connection::Validate
+{
+    const size_t tableCount = 200;
+
+    class validate : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(validate, reading_the_structure_every_time_compared_to_the_metadata_cache)
+    {
+        const size_t operations = scaled(200);
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        TableDefinitions expected;
+        for (size_t x=0; x<tableCount; x++)
+        {
+            const string table = "test.bench" + to_string(x);
+            connection.performUpdate("create table " + table + " (id int primary key, name varchar(255), age int)");
+            expected[table] = {{"id", "int(11)"}, {"name", "varchar(255)"}, {"age", "int(11)"}};
+        }
+
+        const auto uncachedElapsed = timeAction([&connection, &expected, operations]()
+        {
+            for (size_t x=0; x<operations; x++)
+                compareTableDefinitions(expected, connection.getMetaData().data, false);
+        });
+        report("getMetaData and compare for 200 tables", operations, uncachedElapsed);
+
+        const auto firstElapsed = timeAction([&connection, &expected]()
+        {
+            connection.validate(expected, false);
+        });
+        report("first validate of 200 tables", 1, firstElapsed);
+
+        // a cache hit still has the server scan information_schema.COLUMNS to work out the checksum, this shows what
+        // that scan costs compared to reading the whole structure
+        const auto cachedElapsed = timeAction([&connection, &expected, operations]()
+        {
+            for (size_t x=0; x<operations; x++) EXPECT_TRUE(connection.validate(expected, false).empty());
+        });
+        report("cached validate of 200 tables", operations, cachedElapsed);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <deque>
+#include <future>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "AsyncConnection.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Async_Connection
+{
+    const size_t connectionCount = 4, inFlight = 64;
+    const string selectQuery = "select id, value from test where id = ?;";
+
+    TEST(asyncConnection, many_queries_in_flight_compared_to_blocking_calls_from_one_thread)
+    {
+        const size_t operations = scaled(50000);
+        const TemporaryFile database = ".sfdb_bench_2a7e5c1f9d0b4c38a6f3e8b0d5c2a917";
+        SqliteConnection setup = database.getPath();
+        setup.connect();
+        setup.performUpdate("pragma journal_mode = wal;");
+        setup.performUpdate("create table test (id int primary key, value varchar(255));");
+        vector<ParameterRow> rows;
+        for (int64_t x=0; x<1000; x++) rows.push_back({x, "seed"});
+        setup.executeBatch("insert into test (id, value) values (?, ?);", rows);
+
+        const auto blockingElapsed = timeAction([&setup, operations]()
+        {
+            for (size_t x=0; x<operations; x++)
+                setup.performTableQuery(StructuredQuery{selectQuery, {to_string(x % 1000)}});
+        });
+        report("blocking queries from one thread", operations, blockingElapsed);
+
+        vector<unique_ptr<AsyncConnection<SqliteConnection>>> connections;
+        for (size_t x=0; x<connectionCount; x++)
+            connections.emplace_back(make_unique<AsyncConnection<SqliteConnection>>(database.getPath()));
+        const auto asyncElapsed = timeAction([&connections, operations]()
+        {
+            // the submitting thread keeps up to inFlight queries outstanding, the way an event loop would
+            deque<future<Result<ResultTable>>> pending;
+            for (size_t x=0; x<operations; x++)
+            {
+                if (pending.size() >= inFlight)
+                {
+                    pending.front().get();
+                    pending.pop_front();
+                }
+                pending.emplace_back(connections[x % connectionCount]->performTableQueryAsync(
+                    {selectQuery, {to_string(x % 1000)}}));
+            }
+            for (auto& result : pending) result.get();
+        });
+        report("async queries over 4 connections with 64 in flight", operations, asyncElapsed);
+    }
+}
\ No newline at end of file
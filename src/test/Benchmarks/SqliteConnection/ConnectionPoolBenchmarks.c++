@@ -0,0 +1,102 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <thread>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Connection_Pool
+{
+    const size_t threadCount = 8;
+    const string selectQuery = "select id, value from test where id = ?;";
+
+    void createDatabase(const string& databasePath)
+    {
+        SqliteConnection connection = databasePath;
+        connection.connect();
+        connection.performUpdate("create table test (id int primary key, value varchar(255));");
+        connection.startTransaction();
+        for (int x=0; x<1000; x++)
+            connection.performUpdate(StructuredQuery{"insert into test (id, value) values (?, 'seed');",
+                {to_string(x)}});
+        connection.commitTransaction();
+    }
+
+    chrono::nanoseconds runOnThreads(size_t operationsPerThread, const function<void(size_t)>& operation)
+    {
+        return timeAction([operationsPerThread, &operation]()
+        {
+            vector<thread> threads;
+            for (size_t x=0; x<threadCount; x++)
+                threads.emplace_back([operationsPerThread, &operation]()
+                {
+                    for (size_t y=0; y<operationsPerThread; y++) operation(y);
+                });
+            for (auto& thread : threads) thread.join();
+        });
+    }
+
+    void reportPool(ConnectionPool<SqliteConnection>& pool)
+    {
+        const auto statistics = pool.getStatistics();
+        cout << "[ BENCHMARK]     average wait "
+            << chrono::duration<double, micro>(statistics.totalWaitTime).count() / statistics.acquisitions
+            << " us, longest wait " << chrono::duration<double, micro>(statistics.maximumWaitTime).count()
+            << " us, utilization " << statistics.utilization * 100 << "%, connections opened "
+            << statistics.connectionsOpened << endl;
+    }
+
+    TEST(connectionPool, pooled_connections_compared_to_a_new_connection_per_request)
+    {
+        const size_t operationsPerThread = scaled(2000);
+        const TemporaryFile database = ".sfdb_bench_1f6c3a9e0d4b4f72b8e5a2c7d1f0b396";
+        createDatabase(database.getPath());
+
+        const auto newConnectionElapsed = runOnThreads(operationsPerThread, [&database](size_t x)
+        {
+            SqliteConnection connection = database.getPath();
+            connection.connect();
+            connection.performQuery(StructuredQuery{selectQuery, {to_string(x % 1000)}});
+        });
+        report("new connection per request on 8 threads", operationsPerThread * threadCount, newConnectionElapsed);
+
+        ConnectionPool<SqliteConnection> pool(database.getPath(), SqliteConnection::getPoolOptions(threadCount));
+        const auto pooledElapsed = runOnThreads(operationsPerThread, [&pool](size_t x)
+        {
+            pool.acquire()->performQuery(StructuredQuery{selectQuery, {to_string(x % 1000)}});
+        });
+        report("pooled connection per request on 8 threads", operationsPerThread * threadCount, pooledElapsed);
+        reportPool(pool);
+    }
+
+    TEST(connectionPool, acquire_and_release_contention)
+    {
+        const size_t operationsPerThread = scaled(50000);
+        const TemporaryFile database = ".sfdb_bench_8b2e5d0f7a1c4e39a6d3f9b0c4e8a152";
+        createDatabase(database.getPath());
+
+        for (const size_t poolSize : {(size_t)2, threadCount})
+        {
+            ConnectionPool<SqliteConnection> pool(database.getPath(), SqliteConnection::getPoolOptions(poolSize));
+            const auto elapsed = runOnThreads(operationsPerThread, [&pool](size_t)
+            {
+                pool.acquire();
+            });
+            report("acquire and release on 8 threads with a pool of " + to_string(poolSize),
+                operationsPerThread * threadCount, elapsed);
+            reportPool(pool);
+        }
+    }
+}
\ No newline at end of file
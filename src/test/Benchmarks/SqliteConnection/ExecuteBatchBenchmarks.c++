@@ -0,0 +1,56 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Execute_Batch
+{
+    const string insertQuery = "insert into test (id, weight, name) values (?, ?, ?);";
+
+    SqliteConnection createDatabase(const string& databasePath)
+    {
+        SqliteConnection connection = databasePath;
+        connection.connect();
+        connection.performUpdate("create table test (id int primary key, weight real, name varchar(255));");
+        return connection;
+    }
+
+    TEST(executeBatch, bulk_insert_compared_to_a_row_at_a_time)
+    {
+        const size_t rows = scaled(1000000);
+
+        const TemporaryFile rowAtATimeDatabase = ".sfdb_bench_5c1e9a3d7f0b4e62a8d4c6f2b0e9a713";
+        SqliteConnection rowAtATime = createDatabase(rowAtATimeDatabase.getPath());
+        const auto rowAtATimeElapsed = timeAction([&rowAtATime, rows]()
+        {
+            rowAtATime.startTransaction();
+            for (size_t x=0; x<rows; x++)
+                rowAtATime.performUpdate(StructuredQuery{insertQuery, {to_string(x), "2.5", "benchmark"}});
+            rowAtATime.commitTransaction();
+        });
+        report("insert one row at a time in a transaction", rows, rowAtATimeElapsed);
+
+        const TemporaryFile batchDatabase = ".sfdb_bench_e2a7d0f4b9c14a85b3f6e1c8d5a0b294";
+        SqliteConnection batch = createDatabase(batchDatabase.getPath());
+        vector<ParameterRow> parameters;
+        parameters.reserve(rows);
+        for (size_t x=0; x<rows; x++) parameters.push_back({(int64_t)x, 2.5, "benchmark"});
+        const auto batchElapsed = timeAction([&batch, &parameters]()
+        {
+            batch.executeBatch(insertQuery, parameters);
+        });
+        report("insert with executeBatch", rows, batchElapsed);
+    }
+}
\ No newline at end of file
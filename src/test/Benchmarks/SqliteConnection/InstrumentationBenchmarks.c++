@@ -0,0 +1,58 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <iostream>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Instrumentation
+{
+    const string selectQuery = "select id, value from test where id = ?;";
+
+    chrono::nanoseconds runQueries(SqliteConnection& connection, size_t operations)
+    {
+        return timeAction([&connection, operations]()
+        {
+            for (size_t x=0; x<operations; x++)
+                connection.performTableQuery(StructuredQuery{selectQuery, {to_string(x % 1000)}});
+        });
+    }
+
+    TEST(instrumentation, point_lookups_with_instrumentation_turned_off_and_on)
+    {
+        const size_t operations = scaled(100000);
+        const TemporaryFile database = ".sfdb_bench_8d2f6b0e4a1c4e73b9d5a0c3f7e2b618";
+        SqliteConnection connection = database.getPath();
+        connection.connect();
+        connection.performUpdate("create table test (id int primary key, value varchar(255));");
+        vector<ParameterRow> rows;
+        for (int64_t x=0; x<1000; x++) rows.push_back({x});
+        connection.executeBatch("insert into test (id, value) values (?, 'seed');", rows);
+
+        runQueries(connection, 1000);
+        const auto offElapsed = runQueries(connection, operations);
+        report("point lookups with instrumentation off", operations, offElapsed);
+
+        connection.enableInstrumentation();
+        const auto onElapsed = runQueries(connection, operations);
+        report("point lookups with instrumentation on", operations, onElapsed);
+
+        const LatencyHistogram histogram = connection.getLatencyHistograms().at(selectQuery);
+        cout << "[ BENCHMARK]     p50 " << chrono::duration<double, micro>(histogram.getPercentile(0.5)).count()
+            << " us, p99 " << chrono::duration<double, micro>(histogram.getPercentile(0.99)).count()
+            << " us, overhead " << (onElapsed.count() - offElapsed.count()) * 100.0 / offElapsed.count() << "%"
+            << endl;
+        EXPECT_EQ(operations, histogram.getCount());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Parallel_Read
+{
+    const size_t tableCount = 64;
+
+    void createTables(SqliteConnection& connection, size_t rowsPerTable)
+    {
+        for (size_t x=0; x<tableCount; x++)
+        {
+            const string table = "table" + to_string(x);
+            connection.performUpdate("create table " + table +
+                " (id int primary key, weight real, name varchar(255));");
+            vector<ParameterRow> rows;
+            for (size_t y=0; y<rowsPerTable; y++) rows.push_back({(int64_t)y, y * 0.5, "row " + to_string(y)});
+            connection.executeBatch("insert into " + table + " (id, weight, name) values (?, ?, ?);", rows);
+        }
+    }
+
+    TEST(parallelRead, getAllData_with_workers_compared_to_one_table_at_a_time)
+    {
+        const size_t rowsPerTable = scaled(5000);
+        const TemporaryFile database = ".sfdb_bench_4e9b1d6a3f0c4b82a7e5c2d9f1b0a637";
+        SqliteConnection connection = database.getPath();
+        connection.connect();
+        createTables(connection, rowsPerTable);
+
+        for (const size_t workers : {(size_t)1, (size_t)2, (size_t)4, (size_t)8})
+        {
+            const auto elapsed = timeAction([&connection, workers]()
+            {
+                connection.getAllData(workers);
+            });
+            report("getAllData of " + to_string(tableCount) + " tables with " + to_string(workers) + " workers",
+                tableCount * rowsPerTable, elapsed);
+        }
+    }
+}
\ No newline at end of file
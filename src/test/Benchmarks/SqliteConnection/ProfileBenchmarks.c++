@@ -0,0 +1,104 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Profile
+{
+    const string selectQuery = "select id, value from test where id = ?;";
+    const string insertQuery = "insert into test (id, value) values (?, ?);";
+
+    class profile : public ::testing::Test
+    {
+    protected:
+        inline static const string fixturePath = ".sfdb_bench_profile_fixture_5d9b1e7a3c0f4a62";
+        inline static size_t rowCount = 0;
+
+        // the fixture is built once and copied for every profile, so each profile starts from the same file
+        static void SetUpTestSuite()
+        {
+            rowCount = scaled(500000);
+            SqliteConnection connection(fixturePath, SqliteConnection::Options::inMemory());
+            connection.connect();
+            connection.performUpdate("create table test (id int primary key, value varchar(255));");
+
+            vector<ParameterRow> rows;
+            for (size_t x=0; x<rowCount; x++)
+                rows.push_back({(int64_t)x, "a value that is long enough to fill a page a little " + to_string(x)});
+            connection.executeBatch(insertQuery, rows);
+        }
+
+        static void TearDownTestSuite()
+        {
+            filesystem::remove(fixturePath);
+        }
+
+        static void runProfile(const string& name, const SqliteConnection::Options& options)
+        {
+            const TemporaryFile database = ".sfdb_bench_profile_copy_8e2c4a0f6b1d4f37";
+            filesystem::copy_file(fixturePath, database.getPath(), filesystem::copy_options::overwrite_existing);
+            SqliteConnection connection(database.getPath(), options);
+            ASSERT_TRUE(connection.connect());
+
+            const size_t reads = scaled(100000);
+            const auto readElapsed = timeAction([&connection, reads]()
+            {
+                for (size_t x=0; x<reads; x++)
+                    connection.performTableQuery(StructuredQuery{selectQuery, {to_string(x * 7919 % rowCount)}});
+            });
+            report(name + " point reads", reads, readElapsed);
+
+            size_t scanned = 0;
+            const auto scanElapsed = timeAction([&connection, &scanned]()
+            {
+                connection.streamQuery({"select * from test;", {}}, [&scanned](const ResultTable::RowView&)
+                {
+                    scanned++;
+                    return true;
+                });
+            });
+            report(name + " full table scan rows", scanned, scanElapsed);
+
+            const size_t writes = scaled(2000);
+            const auto writeElapsed = timeAction([&connection, writes]()
+            {
+                for (size_t x=0; x<writes; x++)
+                    connection.executeBatch(insertQuery, {{(int64_t)(rowCount + x), "new"}});
+            });
+            report(name + " single row commits", writes, writeElapsed);
+        }
+    };
+
+    TEST_F(profile, default_options)
+    {
+        runProfile("default", {});
+    }
+
+    TEST_F(profile, read_heavy)
+    {
+        runProfile("read heavy", SqliteConnection::Options::readHeavy());
+    }
+
+    TEST_F(profile, write_heavy)
+    {
+        runProfile("write heavy", SqliteConnection::Options::writeHeavy());
+    }
+
+    TEST_F(profile, in_memory)
+    {
+        runProfile("in memory", SqliteConnection::Options::inMemory());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Result_Table
+{
+    TEST(resultTable, large_select_compared_to_performQuery)
+    {
+        const TemporaryFile database = ".sfdb_bench_1c7e4a9d2b0f4e38a5d6c3f8b1e0a792";
+        const size_t rows = scaled(100000);
+        SqliteConnection connection = database.getPath();
+        connection.connect();
+        connection.performUpdate("create table test (id int primary key, weight real, name varchar(255));");
+        connection.startTransaction();
+        for (size_t x=0; x<rows; x++)
+            connection.performUpdate(StructuredQuery{"insert into test values (?, ?, ?);",
+                {to_string(x), to_string(x * 0.5), "name number " + to_string(x)}});
+        connection.commitTransaction();
+
+        report("select into QueryReturnData", rows, timeAction([&connection]()
+        {
+            connection.performQuery("select * from test;");
+        }));
+        report("select into ResultTable", rows, timeAction([&connection]()
+        {
+            connection.performTableQuery("select * from test;");
+        }));
+    }
+}
\ No newline at end of file
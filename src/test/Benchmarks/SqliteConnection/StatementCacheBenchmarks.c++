@@ -0,0 +1,74 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Statement_Cache
+{
+    void runSelects(SqliteConnection& connection, size_t operations)
+    {
+        for (size_t x=0; x<operations; x++)
+            connection.performQuery(StructuredQuery{"select id, value from test where id = ?;",
+                {to_string(x % 1000)}});
+    }
+
+    void runInserts(SqliteConnection& connection, size_t operations)
+    {
+        connection.startTransaction();
+        for (size_t x=0; x<operations; x++)
+            connection.performUpdate(StructuredQuery{"insert into test (id, value) values (?, ?);",
+                {to_string(x + 1000), "benchmark"}});
+        connection.commitTransaction();
+    }
+
+    void compareCacheOnAndOff(const string& name, const string& databasePath,
+        const function<void(SqliteConnection&, size_t)>& scenario)
+    {
+        const size_t operations = scaled(100000);
+
+        for (const size_t cacheSize : {(size_t)0, (size_t)64})
+        {
+            SqliteConnection connection = databasePath;
+            connection.connect();
+            connection.setStatementCacheSize(cacheSize);
+            connection.performUpdate("create table test (id int primary key, value varchar(255));");
+            connection.startTransaction();
+            for (int x=0; x<1000; x++)
+                connection.performUpdate(StructuredQuery{"insert into test (id, value) values (?, 'seed');",
+                    {to_string(x)}});
+            connection.commitTransaction();
+
+            const auto elapsed = timeAction([&connection, &scenario, operations]()
+            {
+                scenario(connection, operations);
+            });
+            report(name + (cacheSize == 0 ? " (cache off)" : " (cache on)"), operations, elapsed);
+
+            connection.performUpdate("drop table test;");
+        }
+    }
+
+    TEST(statementCache, repeated_parameterized_select)
+    {
+        const TemporaryFile database = ".sfdb_bench_a41f7c2e9d0b4b5f8e6a3c1d2f7b9e04";
+        compareCacheOnAndOff("repeated parameterized select", database.getPath(), runSelects);
+    }
+
+    TEST(statementCache, repeated_parameterized_insert)
+    {
+        const TemporaryFile database = ".sfdb_bench_6d3b8e1f0a2c4d7e9b5f1a8c3e6d0b27";
+        compareCacheOnAndOff("repeated parameterized insert", database.getPath(), runInserts);
+    }
+}
\ No newline at end of file
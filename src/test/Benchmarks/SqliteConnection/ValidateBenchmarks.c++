@@ -0,0 +1,57 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "BenchmarkHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Benchmarks::Sqlite_Connection::Validate
+{
+    const size_t tableCount = 200;
+
+    TEST(validate, reading_the_structure_every_time_compared_to_the_metadata_cache)
+    {
+        const size_t operations = scaled(200);
+        const TemporaryFile database = ".sfdb_bench_7c4a0e9d2f6b4d81a3e5b1c8f0d7a264";
+        SqliteConnection connection = database.getPath();
+        connection.connect();
+        TableDefinitions expected;
+        connection.startTransaction();
+        for (size_t x=0; x<tableCount; x++)
+        {
+            const string table = "table" + to_string(x);
+            connection.performUpdate("create table " + table + " (id int primary key, name varchar(255), age int);");
+            expected[table] = {{"id", "INT"}, {"name", "varchar(255)"}, {"age", "INT"}};
+        }
+        connection.commitTransaction();
+
+        const auto uncachedElapsed = timeAction([&connection, &expected, operations]()
+        {
+            for (size_t x=0; x<operations; x++)
+                compareTableDefinitions(expected, connection.getMetaData().data, true);
+        });
+        report("getMetaData and compare for 200 tables", operations, uncachedElapsed);
+
+        const auto firstElapsed = timeAction([&connection, &expected]()
+        {
+            connection.validate(expected, true);
+        });
+        report("first validate of 200 tables", 1, firstElapsed);
+
+        const auto cachedElapsed = timeAction([&connection, &expected, operations]()
+        {
+            for (size_t x=0; x<operations; x++) EXPECT_TRUE(connection.validate(expected, true).empty());
+        });
+        report("cached validate of 200 tables", operations, cachedElapsed);
+    }
+}
\ No newline at end of file
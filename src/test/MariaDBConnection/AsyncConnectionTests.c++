@@ -0,0 +1,69 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <thread>
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "AsyncConnection.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::Async_Connection
+{
+    class asyncConnection : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(asyncConnection, will_run_work_in_the_order_it_was_submitted)
+    {
+        //given we have an async connection to a database
+        AsyncConnection<MariaDBConnection> connection(connectionInformation);
+
+        //when we submit an update and then a query without waiting in between
+        auto insert = connection.performUpdateAsync({"insert into test.table1 values (4, 'apple', 0)"});
+        auto count = connection.performQueryAsync({"select count(*) as total from test.table1"});
+
+        //then the query saw the update
+        EXPECT_EQ("", insert.get().errorText);
+        EXPECT_EQ("4", count.get().data[0].at("total"));
+    }
+
+    TEST_F(asyncConnection, cancel_will_kill_the_running_query_and_throw_away_the_queued_work)
+    {
+        //given we have an async connection that is running a long query, with more work queued behind it
+        AsyncConnection<MariaDBConnection> connection(connectionInformation);
+        auto running = connection.performQueryAsync({"select sleep(30) as slept"});
+        auto queued = connection.performUpdateAsync({"delete from test.table1"});
+        while (connection.getPendingCount() > 1) this_thread::yield();
+        this_thread::sleep_for(chrono::milliseconds(200));
+        const auto start = chrono::steady_clock::now();
+
+        //when we cancel everything
+        const size_t cancelled = connection.cancel();
+        running.wait();
+
+        //then the long query is stopped early and the queued work never runs
+        EXPECT_EQ(1, cancelled);
+        EXPECT_LT(chrono::steady_clock::now() - start, chrono::seconds(10));
+        EXPECT_EQ(AsyncConnection<MariaDBConnection>::cancelledError, queued.get().errorText);
+        EXPECT_EQ(3, connection.performQueryAsync({"select * from test.table1"}).get().data.size());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::Connection_Pool
+{
+    class connectionPool : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(connectionPool, will_hand_out_connected_connections_that_can_be_used_from_the_lease)
+    {
+        //given we have a pool
+        ConnectionPool<MariaDBConnection> pool(connectionInformation);
+
+        //when we lease a connection and run a query on it
+        auto lease = pool.acquire();
+
+        //then the connection is connected and usable
+        ASSERT_TRUE(lease);
+        EXPECT_TRUE(lease->isConnected());
+        EXPECT_EQ(3, lease->performQuery("select * from test.table1").data.size());
+    }
+
+    TEST_F(connectionPool, will_reuse_idle_connections_instead_of_opening_new_ones)
+    {
+        //given we have a pool with one open connection
+        ConnectionPool<MariaDBConnection> pool(connectionInformation);
+
+        //when we lease a connection three times in a row
+        for (int x=0; x<3; x++) pool.acquire();
+
+        //then no other connections were opened
+        const auto actual = pool.getStatistics();
+        EXPECT_EQ(1, actual.connectionsOpened);
+        EXPECT_EQ(3, actual.acquisitions);
+    }
+
+    TEST_F(connectionPool, will_return_an_empty_lease_if_the_server_can_not_be_reached)
+    {
+        //given we have a pool pointed at a port nobody is listening on
+        MariaDBConnection::ConnectionInformation badInformation = getConnectionInformationFromEnvironment();
+        badInformation.portNumber = 1;
+        ConnectionPoolOptions<MariaDBConnection> options;
+        options.minimumSize = 0;
+        ConnectionPool<MariaDBConnection> pool(badInformation, options);
+
+        //when we try to lease a connection
+        auto actual = pool.acquire();
+
+        //then we get nothing back
+        EXPECT_FALSE(actual);
+        EXPECT_EQ(1, pool.getStatistics().connectionsDiscarded);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::ExecuteBatch
+{
+    const string insertQuery = "insert into test.table1 (id, name, dead) values (?, ?, ?)";
+
+    class executeBatch : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(executeBatch, will_return_connected_false_if_the_database_is_not_connected)
+    {
+        //given we have a database that we are not connected to
+        MariaDBConnection connection = connectionInformation;
+
+        //when we try to execute a batch
+        const auto actual = connection.executeBatch(insertQuery, {{4, "apple", 0}});
+
+        //then we get back a connected value of false
+        const Result<void*> expected = {false, 0, "", {{insertQuery}}, nullptr};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(executeBatch, will_run_the_statement_once_for_every_row_of_parameters)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we execute a batch of two rows
+        const auto actual = connection.executeBatch(insertQuery, {{4, "apple", 0}, {5, "cucumber", nullptr}});
+
+        //then both rows are inserted
+        const Result<void*> expected = {true, 2, "", {{insertQuery}}, nullptr};
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(5, connection.performQuery("select * from test.table1").data.size());
+    }
+
+    TEST_F(executeBatch, will_return_an_error_and_change_nothing_if_the_batch_fails)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we try to insert into a table that does not exist
+        const auto actual = connection.executeBatch("insert into test.missing (id) values (?)", {{1}, {2}});
+
+        //then we get an error and nothing was changed
+        EXPECT_FALSE(actual.errorText.empty());
+        EXPECT_EQ(0, actual.rowsEffected);
+        EXPECT_EQ(3, connection.performQuery("select * from test.table1").data.size());
+    }
+
+    TEST_F(executeBatch, will_count_one_row_per_entry_when_the_driver_sends_the_batch_in_bulk)
+    {
+        //given we have a connection that sends batches to the server in bulk
+        MariaDBConnection::ConnectionInformation bulkInformation = getConnectionInformationFromEnvironment();
+        bulkInformation.parameters["useBulkStmts"] = "true";
+        MariaDBConnection connection = bulkInformation;
+        connection.connect();
+
+        //when we execute a batch of two rows
+        const auto actual = connection.executeBatch(insertQuery, {{4, "apple", 0}, {5, "cucumber", nullptr}});
+
+        //then both rows are counted
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(2, actual.rowsEffected);
+        EXPECT_EQ(5, connection.performQuery("select * from test.table1").data.size());
+    }
+}
\ No newline at end of file
@@ -75,4 +75,36 @@ namespace StiltFox::StorageShed::Tests::MariaDB_Connection::GetAllData
         EXPECT_EQ(expected, actual);
         clearDatabase();
     }
+
+    TEST(getAllData, will_return_the_same_data_when_read_with_several_workers)
+    {
+        //given we have a database that we are connected to
+        generateTablesWithSomeData();
+        MariaDBConnection connection = getConnectionInformationFromEnvironment();
+        connection.connect();
+
+        //when we get all the data with four workers
+        const auto actual = connection.getAllData(4);
+
+        //then we get back the same thing as reading the tables one at a time
+        EXPECT_EQ(connection.getAllData(), actual);
+        clearDatabase();
+    }
+
+    TEST(getAllData, will_return_the_same_data_when_read_with_several_workers_while_commits_are_blocked)
+    {
+        //given we have a database that we are connected to, set to block commits while the workers start
+        generateTablesWithSomeData();
+        MariaDBConnection connection = getConnectionInformationFromEnvironment();
+        connection.connect();
+        connection.setBlockCommitsForParallelReads(true);
+
+        //when we get all the data with four workers
+        const auto actual = connection.getAllData(4);
+
+        //then we get back the same thing as reading the tables one at a time, and commits work again afterwards
+        EXPECT_EQ(connection.getAllData(), actual);
+        EXPECT_EQ("", connection.performUpdate("insert into test.table2 values (1, 2)").errorText);
+        clearDatabase();
+    }
 }
\ No newline at end of file
@@ -71,4 +71,19 @@ namespace StiltFox::StorageShed::Tests::MariaDB_Connection::GetMetaData
         EXPECT_EQ(expected, actual);
         clearDatabase();
     }
+
+    TEST(getMetaData, will_return_the_same_metadata_when_read_with_several_workers)
+    {
+        //given we have a database that we are connected to
+        generateTablesWithSomeData();
+        MariaDBConnection connection = getConnectionInformationFromEnvironment();
+        connection.connect();
+
+        //when we get the metadata with four workers
+        const auto actual = connection.getMetaData(4);
+
+        //then we get back the same thing as getMetaData()
+        EXPECT_EQ(connection.getMetaData(), actual);
+        clearDatabase();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::Instrumentation
+{
+    class instrumentation : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(instrumentation, will_not_fill_in_metrics_while_it_is_turned_off)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we run a query without turning instrumentation on
+        const auto actual = connection.performTableQuery("select * from test.table1");
+
+        //then no metrics are recorded
+        EXPECT_FALSE(actual.metrics.has_value());
+        EXPECT_TRUE(connection.getLatencyHistograms().empty());
+    }
+
+    TEST_F(instrumentation, will_record_the_rows_read_and_a_histogram_for_each_query_text)
+    {
+        //given we have a database with instrumentation turned on
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.enableInstrumentation();
+
+        //when we run the same query twice
+        connection.performTableQuery("select * from test.table1");
+        const auto actual = connection.performTableQuery("select * from test.table1");
+
+        //then the rows are counted and both runs are in the histogram
+        ASSERT_TRUE(actual.metrics.has_value());
+        EXPECT_EQ(3, actual.metrics->rows);
+        EXPECT_GT(actual.metrics->bytes, 0);
+        EXPECT_EQ(2, connection.getLatencyHistograms().at("select * from test.table1").getCount());
+    }
+
+    TEST_F(instrumentation, will_call_the_slow_query_callback_for_queries_that_take_long_enough)
+    {
+        //given we have a database with a slow query threshold of nothing at all
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        size_t slowQueries = 0;
+        connection.enableInstrumentation(chrono::nanoseconds::zero(),
+            [&slowQueries](const StructuredQuery&, const QueryMetrics&) { slowQueries++; });
+
+        //when we run a query
+        connection.performQuery("select * from test.table1");
+
+        //then the callback was called
+        EXPECT_EQ(1, slowQueries);
+    }
+}
\ No newline at end of file
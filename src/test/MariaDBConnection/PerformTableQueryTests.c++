@@ -0,0 +1,146 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::PerformTableQuery
+{
+    class performTableQuery : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(performTableQuery, will_return_connected_false_if_the_database_is_not_connected)
+    {
+        //given we have a database that we are not connected to
+        MariaDBConnection connection = connectionInformation;
+
+        //when we try to perform a query
+        const auto actual = connection.performTableQuery("select * from test.table1");
+
+        //then we get back a connected value of false
+        const Result<ResultTable> expected = {false, 0, "", {{"select * from test.table1"}}, {}};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(performTableQuery, will_return_integers_as_numbers_and_text_as_text)
+    {
+        //given we have a database with some data, and we connect to it
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we perform a query that returns a number and some text
+        const auto actual = connection.performTableQuery("select id, name from test.table1 order by id");
+
+        //then we get back the values in their native types
+        ResultTable expectedData;
+        expectedData.setColumnNames({"id", "name"});
+        expectedData.appendInteger(1);
+        expectedData.appendText("bagel");
+        expectedData.appendInteger(2);
+        expectedData.appendText("fork");
+        expectedData.appendInteger(3);
+        expectedData.appendText("pickle");
+        const Result<ResultTable> expected =
+        {
+            true,
+            0,
+            "",
+            {{"select id, name from test.table1 order by id"}},
+            expectedData
+        };
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(performTableQuery, will_return_null_values_as_null)
+    {
+        //given we have a row with a null value
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.performUpdate("insert into test.table1 (id) values (4)");
+
+        //when we query that row
+        const auto actual = connection.performTableQuery("select id, name from test.table1 where id = 4");
+
+        //then the missing value is null
+        EXPECT_EQ(1, actual.data.getRowCount());
+        EXPECT_TRUE(actual.data.isNull(0, 1));
+    }
+
+    TEST_F(performTableQuery, will_convert_to_the_same_data_that_performQuery_returns)
+    {
+        //given we have a database with some data and a table of floating point numbers, and we connect to it
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.performUpdate("create table test.numbers (id int, weight float, height double)");
+        connection.performUpdate("insert into test.numbers values (1, 0.1, 3), (2, 2.5, 0.1), (3, null, 1e20)");
+
+        //when we run the same queries through both functions
+        const auto actual = connection.performTableQuery("select * from test.table1");
+        const auto expected = connection.performQuery("select * from test.table1");
+        const auto actualNumbers = connection.performTableQuery("select * from test.numbers order by id");
+        const auto expectedNumbers = connection.performQuery("select * from test.numbers order by id");
+
+        //then the converted tables match the row of maps format
+        EXPECT_EQ(expected.data, actual.data.toQueryReturnData());
+        EXPECT_EQ(expectedNumbers.data, actualNumbers.data.toQueryReturnData());
+        EXPECT_EQ(ValueType::Real, actualNumbers.data.getType(0, 1));
+        EXPECT_EQ(3, actualNumbers.data.getReal(0, 2));
+    }
+
+    TEST_F(performTableQuery, will_return_bigints_as_integers_and_doubles_as_reals)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we perform a query that returns a bigint, a double, a decimal and an unsigned bigint
+        const auto actual = connection.performTableQuery(
+            "select count(*) as total, cast(2.5 as double) as weight, cast(1.25 as decimal(4,2)) as price, "
+            "cast(18446744073709551615 as unsigned) as big from test.table1");
+
+        //then the numbers that fit are numbers, and the others are kept as text
+        EXPECT_EQ(ValueType::Integer, actual.data.getType(0, 0));
+        EXPECT_EQ(3, actual.data.getInteger(0, 0));
+        EXPECT_EQ(ValueType::Real, actual.data.getType(0, 1));
+        EXPECT_EQ(2.5, actual.data.getReal(0, 1));
+        EXPECT_EQ(ValueType::Text, actual.data.getType(0, 2));
+        EXPECT_EQ("1.25", actual.data.getText(0, 2));
+        EXPECT_EQ(ValueType::Text, actual.data.getType(0, 3));
+        EXPECT_EQ("18446744073709551615", actual.data.getText(0, 3));
+    }
+
+    TEST_F(performTableQuery, will_return_the_column_names_when_no_rows_are_found)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we perform a query that does not match any rows
+        const auto actual = connection.performTableQuery("select id, name from test.table1 where id = 4");
+
+        //then the table has no rows but still has its columns
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(0, actual.data.getRowCount());
+        EXPECT_EQ((std::vector<std::string>{"id", "name"}), actual.data.getColumnNames());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::Statement_Cache
+{
+    class statementCache : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(statementCache, will_count_a_miss_the_first_time_a_query_is_run_and_a_hit_after_that)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we run the same query three times
+        for (int x=0; x<3; x++) connection.performQuery("select * from test.table1");
+
+        //then we get one miss and two hits
+        const StatementCacheStatistics expected = {2, 1, 0, 1, 64};
+        EXPECT_EQ(expected, connection.getStatementCacheStatistics());
+    }
+
+    TEST_F(statementCache, will_rebind_parameters_when_a_cached_statement_is_reused)
+    {
+        //given we have a database and a parameterized query that has already been run
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.performQuery(StructuredQuery{"select name from test.table1 where id = ?", {"1"}});
+
+        //when we run the same query with a different parameter
+        const auto actual = connection.performQuery(StructuredQuery{"select name from test.table1 where id = ?", {"3"}});
+
+        //then we get back the row for the new parameter
+        const Result<QueryReturnData> expected =
+        {
+            true,
+            0,
+            "",
+            {{"select name from test.table1 where id = ?", {"3"}}},
+            {{{"name", "pickle"}}}
+        };
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(statementCache, will_be_cleared_when_the_connection_is_disconnected)
+    {
+        //given we have a connection with a cached statement
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.performQuery("select * from test.table1");
+
+        //when we disconnect
+        connection.disconnect();
+
+        //then the cache is empty
+        EXPECT_EQ(0, connection.getStatementCacheStatistics().size);
+    }
+
+    TEST_F(statementCache, will_be_cleared_when_the_structure_of_the_database_changes)
+    {
+        //given we have a connection with a cached statement
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.performQuery("select * from test.table1");
+
+        //when we change the structure of the database
+        connection.performUpdate("alter table test.table1 add column weight int");
+        const auto actual = connection.performQuery("select * from test.table1 where id = 1");
+
+        //then the cache was emptied and queries see the new structure
+        EXPECT_EQ(1, connection.getStatementCacheStatistics().size);
+        EXPECT_EQ(4, actual.data[0].size());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <limits>
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::StreamQuery
+{
+    class streamQuery : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(streamQuery, will_return_connected_false_if_the_database_is_not_connected)
+    {
+        //given we have a database that we are not connected to
+        MariaDBConnection connection = connectionInformation;
+
+        //when we try to stream a query
+        const auto actual = connection.streamQuery({"select * from test.table1", {}}, [](const auto&)
+        {
+            return true;
+        });
+
+        //then we get back a connected value of false
+        const Result<void*> expected = {false, 0, "", {{"select * from test.table1"}}, nullptr};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(streamQuery, will_visit_every_row_in_order)
+    {
+        //given we have a database with some data, and we connect to it
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        vector<string> names;
+
+        //when we stream a query
+        const auto actual = connection.streamQuery({"select name from test.table1 order by id", {}},
+            [&names](const ResultTable::RowView& row)
+            {
+                names.emplace_back(row.getText(0));
+                return true;
+            });
+
+        //then each row was visited
+        const vector<string> expectedNames = {"bagel", "fork", "pickle"};
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(expectedNames, names);
+    }
+
+    TEST_F(streamQuery, will_stop_reading_rows_when_the_visitor_returns_false)
+    {
+        //given we have a database with some data, and we connect to it
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        int visited = 0;
+
+        //when we stop after the first row
+        const auto actual = connection.streamQuery({"select * from test.table1", {}}, [&visited](const auto&)
+        {
+            visited++;
+            return false;
+        });
+
+        //then only one row was read and the connection can still be used
+        EXPECT_EQ(1, visited);
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(3, connection.performQuery("select * from test.table1").data.size());
+    }
+
+    TEST_F(streamQuery, streamAllData_will_hand_every_table_to_the_sink_including_empty_ones)
+    {
+        //given we have a database with full and empty tables
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        unordered_map<string, size_t> rowCounts;
+
+        //when we stream all the data
+        const auto actual = connection.streamAllData([&rowCounts](const string& table, const ResultTable& rows)
+        {
+            rowCounts[table] += rows.getRowCount();
+            return true;
+        });
+
+        //then every table was handed over
+        const unordered_map<string, size_t> expectedCounts =
+        {
+            {"test.table1", 3},
+            {"test.table2", 0},
+            {"test2.information", 1}
+        };
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(expectedCounts, rowCounts);
+    }
+
+    TEST_F(streamQuery, streamAllData_will_stream_every_row_with_a_batch_size_of_0_or_one_too_large_for_the_driver)
+    {
+        //given we have a database with some data
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        size_t smallBatchRows = 0, largeBatchRows = 0;
+
+        //when we stream all the data with the smallest and the largest batch sizes
+        const auto smallBatches = connection.streamAllData([&smallBatchRows](const string&, const ResultTable& rows)
+        {
+            smallBatchRows += rows.getRowCount();
+            return true;
+        }, 0);
+        const auto largeBatches = connection.streamAllData([&largeBatchRows](const string&, const ResultTable& rows)
+        {
+            largeBatchRows += rows.getRowCount();
+            return true;
+        }, numeric_limits<size_t>::max());
+
+        //then every row is read both times
+        EXPECT_EQ("", smallBatches.errorText);
+        EXPECT_EQ("", largeBatches.errorText);
+        EXPECT_EQ(4, smallBatchRows);
+        EXPECT_EQ(4, largeBatchRows);
+    }
+}
\ No newline at end of file
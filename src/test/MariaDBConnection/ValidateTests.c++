@@ -0,0 +1,153 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <gtest/gtest.h>
+#include "PrintHelper.h++"
+#include "TestHelpFunctions.h++"
+
+using namespace std;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::MariaDB_Connection::Validate
+{
+    class validate : public ::testing::Test
+    {
+    protected:
+        MariaDBConnection connectionInformation = getConnectionInformationFromEnvironment();
+        const TableDefinitions databaseStructure =
+        {
+            {"test.table1", {{"id", "int(11)"}, {"name", "varchar(255)"}, {"dead", "tinyint(1)"}}},
+            {"test.table2", {{"id_1", "int(11)"}, {"id_2", "int(11)"}}},
+            {"test2.information", {{"id", "uuid"}}}
+        };
+
+        void SetUp() override
+        {
+            generateTablesWithSomeData();
+        }
+
+        void TearDown() override
+        {
+            clearDatabase();
+        }
+    };
+
+    TEST_F(validate, will_return_an_error_if_the_database_is_disconnected)
+    {
+        //given we have a database that is not connected
+        MariaDBConnection connection = connectionInformation;
+
+        //when we check the structure of the database
+        const auto actual = connection.validate(databaseStructure, true);
+
+        //then we get back that the database is not connected
+        EXPECT_EQ(1, actual.size());
+        EXPECT_TRUE(actual.begin()->starts_with("Database not connected jdbc:mariadb://"));
+    }
+
+    TEST_F(validate, will_return_no_errors_with_strict_mode_enabled_and_the_expected_database_structure_is_correct)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+
+        //when we check the structure of the database
+        const auto actual = connection.validate(databaseStructure, true);
+
+        //then no differences are found
+        EXPECT_EQ(unordered_set<string>{}, actual);
+    }
+
+    TEST_F(validate, will_detect_missing_wrongly_typed_and_unwanted_columns)
+    {
+        //given we have a database that we connect to
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        TableDefinitions expectedStructure = databaseStructure;
+        expectedStructure["test.table1"].erase("dead");
+        expectedStructure["test.table1"]["name"] = "text";
+        expectedStructure["test.table2"]["id_3"] = "int(11)";
+
+        //when we check the structure of the database in strict mode
+        const auto actual = connection.validate(expectedStructure, true);
+
+        //then each difference is reported
+        const unordered_set<string> expected =
+        {
+            "Unwanted column dead in table test.table1",
+            "Column name in table test.table1 is the wrong type; expected: text actual: varchar(255)",
+            "Missing column in test.table2: id_3"
+        };
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(validate, will_see_changes_made_to_the_structure_after_the_last_validation)
+    {
+        //given we have a database that has already been validated
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.validate(databaseStructure, false);
+
+        //when another connection creates a table and this connection drops one, and we validate again
+        MariaDBConnection otherConnection = connectionInformation;
+        otherConnection.connect();
+        otherConnection.performUpdate("create table test.table3 (id int)");
+        connection.performUpdate("drop table test.table2");
+        const auto actual = connection.validate(databaseStructure, true);
+
+        //then both changes are found
+        const unordered_set<string> expected = {"Unwanted table test.table3", "Missing table test.table2"};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(validate, will_see_a_table_altered_by_another_connection_after_the_last_validation)
+    {
+        //given we have a database that has already been validated
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.validate(databaseStructure, false);
+
+        //when another connection adds a column and changes the type of another, and we validate again
+        MariaDBConnection otherConnection = connectionInformation;
+        otherConnection.connect();
+        otherConnection.performUpdate("alter table test.table2 add column id_3 int, modify column id_2 bigint");
+        const auto actual = connection.validate(databaseStructure, true);
+
+        //then both changes are found
+        const unordered_set<string> expected =
+        {
+            "Unwanted column id_3 in table test.table2",
+            "Column id_2 in table test.table2 is the wrong type; expected: int(11) actual: bigint(20)"
+        };
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST_F(validate, will_see_a_view_replaced_by_another_connection_after_the_last_validation)
+    {
+        //given we have a database with a view that has already been validated
+        MariaDBConnection connection = connectionInformation;
+        connection.connect();
+        connection.performUpdate("create view test.names as select name from test.table1");
+        TableDefinitions expectedStructure = databaseStructure;
+        expectedStructure["test.names"] = {{"name", "varchar(255)"}};
+        connection.validate(expectedStructure, true);
+
+        //when another connection replaces the view with different columns, and we validate again
+        MariaDBConnection otherConnection = connectionInformation;
+        otherConnection.connect();
+        otherConnection.performUpdate("create or replace view test.names as select id from test.table1");
+        const auto actual = connection.validate(expectedStructure, true);
+
+        //then the new columns are found
+        const unordered_set<string> expected =
+        {
+            "Unwanted column id in table test.names",
+            "Missing column in test.names: name"
+        };
+        EXPECT_EQ(expected, actual);
+    }
+}
\ No newline at end of file
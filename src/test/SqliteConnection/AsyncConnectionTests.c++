@@ -0,0 +1,165 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <thread>
+#include <stdexcept>
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "AsyncConnection.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Async_Connection
+{
+    // this takes several seconds, so the test fails instead of hanging if the cancel does not work
+    const string longQuery = "with recursive counter(x) as "
+                             "(select 1 union all select x+1 from counter where x < 50000000) "
+                             "select count(*) as total from counter;";
+
+    void setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, name varchar(255));"
+                                 "insert into test values (1, 'bagel');";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+    }
+
+    TEST(AsyncConnection, will_return_the_result_of_a_query_through_a_future)
+    {
+        //given we have an async connection to a database
+        const TemporaryFile database = ".sfdb_5e2a9c7f1b0d4a86b3e4d8c0f6a1b739";
+        setupDatabase(database);
+        AsyncConnection<SqliteConnection> connection(database.getPath());
+
+        //when we run a query
+        const auto actual = connection.performQueryAsync({"select * from test;", {}}).get();
+
+        //then we get back the same result the blocking call would give
+        const Result<QueryReturnData> expected =
+        {
+            true,
+            0,
+            "",
+            {{"select * from test;"}},
+            {{{"id", "1"}, {"name", "bagel"}}}
+        };
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(AsyncConnection, will_run_work_in_the_order_it_was_submitted)
+    {
+        //given we have an async connection to a database
+        const TemporaryFile database = ".sfdb_b1d8f4a0e6c24b93a7f2c5e9d3b0a168";
+        setupDatabase(database);
+        AsyncConnection<SqliteConnection> connection(database.getPath());
+
+        //when we submit an update, a query, another update and another query without waiting in between
+        auto firstInsert = connection.performUpdateAsync({"insert into test values (2, 'fork');", {}});
+        auto firstCount = connection.performQueryAsync({"select count(*) as total from test;", {}});
+        auto secondInsert = connection.performUpdateAsync({"insert into test values (3, 'pickle');", {}});
+        auto secondCount = connection.performQueryAsync({"select count(*) as total from test;", {}});
+
+        //then each query saw every update submitted before it
+        EXPECT_EQ("", firstInsert.get().errorText);
+        EXPECT_EQ("2", firstCount.get().data[0].at("total"));
+        EXPECT_EQ("", secondInsert.get().errorText);
+        EXPECT_EQ("3", secondCount.get().data[0].at("total"));
+    }
+
+    TEST(AsyncConnection, will_run_any_connection_function_that_is_submitted)
+    {
+        //given we have an async connection to a database
+        const TemporaryFile database = ".sfdb_3c7e0b5d9a2f4c61b8d4a1f7e0c3b925";
+        setupDatabase(database);
+        AsyncConnection<SqliteConnection> connection(database.getPath());
+
+        //when we submit a transaction that is rolled back
+        connection.submit([](SqliteConnection& sqlite) { return sqlite.startTransaction(); });
+        connection.performUpdateAsync({"delete from test;", {}});
+        connection.submit([](SqliteConnection& sqlite) { return sqlite.rollbackTransaction(); });
+        const auto actual = connection.performQueryAsync({"select * from test;", {}}).get();
+
+        //then the delete was undone
+        EXPECT_EQ(1, actual.data.size());
+    }
+
+    TEST(AsyncConnection, will_return_connected_false_if_the_database_could_not_be_opened)
+    {
+        //given we have an async connection to a database that does not exist
+        AsyncConnection<SqliteConnection> connection(".sfdb_does_not_exist_0a8c6e4f2b1d4e97");
+
+        //when we run a query
+        const auto actual = connection.performQueryAsync({"select * from test;", {}}).get();
+
+        //then the result says the database is not connected
+        EXPECT_FALSE(actual.connected);
+    }
+
+    TEST(AsyncConnection, cancel_will_interrupt_the_running_query_and_throw_away_the_queued_work)
+    {
+        //given we have an async connection that has picked up a long query, with more work queued behind it
+        const TemporaryFile database = ".sfdb_d6f1a3c8e0b54d72a9c5e2f0b7d4a381";
+        setupDatabase(database);
+        AsyncConnection<SqliteConnection> connection(database.getPath());
+        auto running = connection.performQueryAsync({longQuery, {}});
+        auto queued = connection.performUpdateAsync({"delete from test;", {}});
+        while (connection.getPendingCount() > 1) this_thread::yield();
+
+        //when we cancel everything
+        const size_t cancelled = connection.cancel();
+
+        //then the running query stops with an error and the queued work never runs
+        EXPECT_EQ(1, cancelled);
+        EXPECT_EQ("interrupted", running.get().errorText);
+        EXPECT_EQ(AsyncConnection<SqliteConnection>::cancelledError, queued.get().errorText);
+        EXPECT_EQ(1, connection.performQueryAsync({"select * from test;", {}}).get().data.size());
+    }
+
+    TEST(AsyncConnection, will_hand_an_exception_thrown_by_the_work_to_the_future)
+    {
+        //given we have an async connection to a database
+        const TemporaryFile database = ".sfdb_2e6a9d1c4f7b4c03a8e5d0b3f6c9a127";
+        setupDatabase(database);
+        AsyncConnection<SqliteConnection> connection(database.getPath());
+
+        //when we submit work that throws
+        auto actual = connection.submit([](SqliteConnection&) -> Result<void*> { throw out_of_range("bagel"); });
+
+        //then the exception comes out of the future and the connection keeps working
+        EXPECT_THROW(actual.get(), out_of_range);
+        EXPECT_EQ(1, connection.performQueryAsync({"select * from test;", {}}).get().data.size());
+    }
+
+    TEST(interrupt, will_stop_every_query_until_the_interrupt_is_cleared)
+    {
+        //given we have a connection to a database
+        const TemporaryFile database = ".sfdb_8a4d0f2c6e1b4f39a5b7c3e9d1f0a264";
+        setupDatabase(database);
+        SqliteConnection connection = database.getPath();
+        connection.connect();
+
+        //when we interrupt it, run a query, clear the interrupt and run the query again
+        connection.interrupt();
+        const auto interrupted = connection.performQuery("select * from test;");
+        connection.clearInterrupt();
+        const auto cleared = connection.performQuery("select * from test;");
+
+        //then only the query run before the interrupt was cleared is stopped
+        EXPECT_EQ("interrupted", interrupted.errorText);
+        EXPECT_EQ("", cleared.errorText);
+        EXPECT_EQ(1, cleared.data.size());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <thread>
+#include <fstream>
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Connection_Pool
+{
+    void setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, name varchar(255));"
+                                 "insert into test values (1, 'bagel');";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+    }
+
+    TEST(ConnectionPool, will_open_the_minimum_number_of_connections_when_it_is_created)
+    {
+        //given we have a database
+        const TemporaryFile database = ".sfdb_0e7b4c9a2d5f4e18b3a6c1d8f0e9b742";
+        setupDatabase(database);
+        ConnectionPoolOptions<SqliteConnection> options;
+        options.minimumSize = 2;
+
+        //when we create a pool
+        ConnectionPool<SqliteConnection> pool(database.getPath(), options);
+
+        //then the connections are already open and waiting
+        const auto actual = pool.getStatistics();
+        EXPECT_EQ(2, actual.size);
+        EXPECT_EQ(2, actual.connectionsOpened);
+        EXPECT_EQ(0, actual.inUse);
+    }
+
+    TEST(ConnectionPool, will_hand_out_a_connected_connection_and_take_it_back_when_the_lease_ends)
+    {
+        //given we have a pool
+        const TemporaryFile database = ".sfdb_6a1f8d3c0b7e4a92a5d4e2f9c7b0a381";
+        setupDatabase(database);
+        ConnectionPool<SqliteConnection> pool(database.getPath());
+        size_t inUse;
+
+        //when we lease a connection and run a query on it
+        {
+            auto lease = pool.acquire();
+            ASSERT_TRUE(lease);
+            EXPECT_TRUE(lease->isConnected());
+            EXPECT_EQ(1, lease->performQuery("select * from test;").data.size());
+            inUse = pool.getStatistics().inUse;
+        }
+
+        //then the connection is back in the pool once the lease is gone
+        const auto actual = pool.getStatistics();
+        EXPECT_EQ(1, inUse);
+        EXPECT_EQ(0, actual.inUse);
+        EXPECT_EQ(1, actual.acquisitions);
+        EXPECT_EQ(1, actual.peakInUse);
+    }
+
+    TEST(ConnectionPool, will_reuse_idle_connections_instead_of_opening_new_ones)
+    {
+        //given we have a pool with one open connection
+        const TemporaryFile database = ".sfdb_b3e9c0f6a2d84b57b1c8e5a0d3f6b924";
+        setupDatabase(database);
+        ConnectionPool<SqliteConnection> pool(database.getPath());
+
+        //when we lease a connection three times in a row
+        for (int x=0; x<3; x++) pool.acquire();
+
+        //then no other connections were opened
+        const auto actual = pool.getStatistics();
+        EXPECT_EQ(1, actual.connectionsOpened);
+        EXPECT_EQ(1, actual.size);
+        EXPECT_EQ(3, actual.acquisitions);
+    }
+
+    TEST(ConnectionPool, will_return_an_empty_lease_if_no_connection_is_freed_in_time)
+    {
+        //given we have a pool of one connection that is already leased
+        const TemporaryFile database = ".sfdb_4d8a2e7f1c0b4d63a9f5b3e1c8a0d275";
+        setupDatabase(database);
+        ConnectionPoolOptions<SqliteConnection> options;
+        options.maximumSize = 1;
+        ConnectionPool<SqliteConnection> pool(database.getPath(), options);
+        auto held = pool.acquire();
+
+        //when we try to lease another connection
+        auto actual = pool.tryAcquire(chrono::milliseconds(10));
+
+        //then we get nothing and the timeout is counted
+        EXPECT_FALSE(actual);
+        EXPECT_EQ(1, pool.getStatistics().timeouts);
+    }
+
+    TEST(ConnectionPool, will_wake_up_a_waiting_thread_when_a_connection_is_given_back)
+    {
+        //given we have a pool of one connection that is already leased
+        const TemporaryFile database = ".sfdb_e8c5b1a9f3d04e76b2a7d0c4f9e1b538";
+        setupDatabase(database);
+        ConnectionPoolOptions<SqliteConnection> options;
+        options.maximumSize = 1;
+        ConnectionPool<SqliteConnection> pool(database.getPath(), options);
+        auto held = pool.acquire();
+        bool leased = false;
+
+        //when another thread waits for a connection and we give ours back
+        thread waiting([&pool, &leased]()
+        {
+            leased = (bool)pool.tryAcquire(chrono::seconds(10));
+        });
+        this_thread::sleep_for(chrono::milliseconds(20));
+        held.release();
+        waiting.join();
+
+        //then the waiting thread got the connection
+        EXPECT_TRUE(leased);
+        EXPECT_EQ(1, pool.getStatistics().size);
+    }
+
+    TEST(ConnectionPool, will_reconnect_idle_connections_that_are_no_longer_connected)
+    {
+        //given we have a pool with a connection that was given back disconnected
+        const TemporaryFile database = ".sfdb_7f2c6e0a4b9d4f81a3e8c5b2d0f7a619";
+        setupDatabase(database);
+        ConnectionPool<SqliteConnection> pool(database.getPath());
+        pool.acquire()->disconnect();
+
+        //when we lease a connection
+        auto actual = pool.acquire();
+
+        //then we get a new connection and the closed one was thrown away
+        ASSERT_TRUE(actual);
+        EXPECT_TRUE(actual->isConnected());
+        EXPECT_EQ(1, pool.getStatistics().connectionsDiscarded);
+        EXPECT_EQ(2, pool.getStatistics().connectionsOpened);
+    }
+
+    TEST(ConnectionPool, will_open_new_connections_to_stay_at_the_minimum_size_when_connections_are_thrown_away)
+    {
+        //given we have a pool that keeps two connections open, and both of them are leased
+        const TemporaryFile database = ".sfdb_9c4e1b7d3a0f4e25b8d6a2c9f1e0b473";
+        setupDatabase(database);
+        ConnectionPoolOptions<SqliteConnection> options;
+        options.minimumSize = 2;
+        ConnectionPool<SqliteConnection> pool(database.getPath(), options);
+        auto first = pool.acquire();
+        auto second = pool.acquire();
+
+        //when both connections are given back disconnected, and another lease is taken
+        first->disconnect();
+        second->disconnect();
+        first.release();
+        second.release();
+        const auto afterRelease = pool.getStatistics();
+        auto third = pool.acquire();
+
+        //then they are thrown away when given back, and replaced by the next acquire
+        const auto actual = pool.getStatistics();
+        EXPECT_EQ(0, afterRelease.size);
+        EXPECT_EQ(2, afterRelease.connectionsDiscarded);
+        EXPECT_TRUE(third);
+        EXPECT_EQ(2, actual.size);
+        EXPECT_EQ(2, actual.connectionsDiscarded);
+        EXPECT_EQ(4, actual.connectionsOpened);
+        EXPECT_EQ(1, actual.inUse);
+    }
+
+    TEST(ConnectionPool, will_count_a_connection_that_can_not_be_opened_once_when_topping_up)
+    {
+        //given we have a pool that should keep one connection open to a file that is not a database
+        const TemporaryFile notADatabase = ".sfdb_5e1c8a3f7d2b4c90a6f4e0b9d3c7a218";
+        ofstream(notADatabase.getPath()) << "this is not a database";
+        ConnectionPool<SqliteConnection> pool(notADatabase.getPath());
+
+        //when we try to lease a connection
+        auto actual = pool.acquire();
+
+        //then we get nothing, and only the pool creation and the one attempt to top it up were thrown away
+        const auto statistics = pool.getStatistics();
+        EXPECT_FALSE(actual);
+        EXPECT_EQ(0, statistics.size);
+        EXPECT_EQ(0, statistics.inUse);
+        EXPECT_EQ(2, statistics.connectionsDiscarded);
+    }
+
+    TEST(ConnectionPool, will_return_an_empty_lease_if_a_connection_can_not_be_opened)
+    {
+        //given we have a file that is not a database
+        const TemporaryFile notADatabase = ".sfdb_2b9d5f1e8a3c4b06b7d2e9f4a1c6b853";
+        ofstream(notADatabase.getPath()) << "this is not a database";
+        ConnectionPoolOptions<SqliteConnection> options;
+        options.minimumSize = 0;
+        ConnectionPool<SqliteConnection> pool(notADatabase.getPath(), options);
+
+        //when we try to lease a connection
+        auto actual = pool.acquire();
+
+        //then we get nothing and the slot is free again
+        const auto statistics = pool.getStatistics();
+        EXPECT_FALSE(actual);
+        EXPECT_EQ(0, statistics.size);
+        EXPECT_EQ(0, statistics.inUse);
+        EXPECT_EQ(1, statistics.connectionsDiscarded);
+    }
+
+    TEST(ConnectionPool, getPoolOptions_will_put_every_connection_in_write_ahead_log_mode)
+    {
+        //given we have a pool that uses the sqlite pool options
+        const TemporaryFile database = ".sfdb_9a0e3d7c5f1b4a28b6c9f2e0d4a7b163";
+        setupDatabase(database);
+        ConnectionPool<SqliteConnection> pool(database.getPath(), SqliteConnection::getPoolOptions());
+
+        //when we ask a pooled connection for its journal mode
+        const auto actual = pool.acquire()->performQuery("pragma journal_mode;");
+
+        //then it is using write ahead logging
+        const QueryReturnData expected = {{{"journal_mode", "wal"}}};
+        EXPECT_EQ(expected, actual.data);
+    }
+
+    TEST(ConnectionPool, getPoolOptions_will_only_hand_out_one_writer_at_a_time)
+    {
+        //given we have a pool that uses the sqlite pool options with a writer already leased
+        const TemporaryFile database = ".sfdb_c1f4a8e2b6d04c97a0e3b7d1f5c8a246";
+        setupDatabase(database);
+        ConnectionPool<SqliteConnection> pool(database.getPath(), SqliteConnection::getPoolOptions());
+        auto writer = pool.acquire(ConnectionAccess::Write);
+        writer->startTransaction();
+        writer->performUpdate("insert into test values (2, 'fork');");
+
+        //when we try to lease another writer and a reader
+        auto secondWriter = pool.tryAcquire(chrono::milliseconds(10), ConnectionAccess::Write);
+        auto reader = pool.tryAcquire(chrono::milliseconds(10), ConnectionAccess::Read);
+
+        //then only the reader is handed out, and it can read while the write is in progress
+        EXPECT_FALSE(secondWriter);
+        ASSERT_TRUE(reader);
+        EXPECT_EQ(1, reader->performQuery("select * from test;").data.size());
+        writer->commitTransaction();
+    }
+}
\ No newline at end of file
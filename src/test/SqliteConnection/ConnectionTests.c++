@@ -12,6 +12,7 @@
 using namespace std;
 using namespace StiltFox::Scribe;
 using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
 
 namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Connection
 {
@@ -82,4 +83,86 @@ namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Connection
         EXPECT_TRUE(actual);
         EXPECT_TRUE(connection.isConnected());
     }
+
+    TEST(connect, will_apply_the_read_heavy_profile_when_it_opens_the_database)
+    {
+        //given we have a database that uses the read heavy profile
+        const TemporaryFile dbFile = ".sqliteConnection_read_heavy_0c5e8a2f7d1b4e96.db";
+        SqliteConnection connection(dbFile.getPath(), SqliteConnection::Options::readHeavy());
+
+        //when we connect and ask for the memory map size and cache size
+        connection.connect();
+        const auto mmapSize = connection.performQuery("pragma mmap_size;");
+        const auto cacheSize = connection.performQuery("pragma cache_size;");
+
+        //then they are the sizes from the profile
+        const QueryReturnData expectedMmapSize = {{{"mmap_size", "268435456"}}};
+        const QueryReturnData expectedCacheSize = {{{"cache_size", "-65536"}}};
+        EXPECT_EQ(expectedMmapSize, mmapSize.data);
+        EXPECT_EQ(expectedCacheSize, cacheSize.data);
+    }
+
+    TEST(connect, will_apply_the_write_heavy_profile_when_it_opens_the_database)
+    {
+        //given we have a database that uses the write heavy profile
+        const TemporaryFile dbFile = ".sqliteConnection_write_heavy_9b2f4d7a0e3c4a58.db";
+        SqliteConnection connection(dbFile.getPath(), SqliteConnection::Options::writeHeavy());
+
+        //when we connect and ask for the journal mode and synchronous setting
+        connection.connect();
+        const auto actual = connection.performQuery(
+            "select journal_mode, synchronous from pragma_journal_mode, pragma_synchronous;");
+
+        //then the database is using write ahead logging with normal syncing
+        const QueryReturnData expected = {{{"journal_mode", "wal"}, {"synchronous", "1"}}};
+        EXPECT_EQ(expected, actual.data);
+    }
+
+    TEST(connect, will_open_an_in_memory_database_with_the_in_memory_profile)
+    {
+        //given we have an in memory database
+        SqliteConnection connection(":memory:", SqliteConnection::Options::inMemory());
+
+        //when we connect and use it
+        const bool actual = connection.connect();
+        connection.performUpdate("create table test (id int);");
+        connection.performUpdate("insert into test values (1);");
+
+        //then it works like any other database
+        EXPECT_TRUE(actual);
+        EXPECT_EQ(1, connection.performQuery("select * from test;").data.size());
+    }
+
+    TEST(connect, will_create_a_file_if_the_options_ask_for_it)
+    {
+        //given we have a non-existing database and options that allow it to be created
+        SqliteConnection::Options options;
+        options.create = true;
+        SqliteConnection connection(".non-existing-created.db", options);
+
+        //when we try to connect
+        const bool actual = connection.connect();
+        connection.disconnect();
+
+        //then the database was created
+        EXPECT_TRUE(actual);
+        EXPECT_TRUE(filesystem::exists(".non-existing-created.db"));
+        filesystem::remove(".non-existing-created.db");
+    }
+
+    TEST(connect, will_not_allow_writes_to_a_database_opened_read_only)
+    {
+        //given we have a database that was opened read only
+        const TemporaryFile dbFile = ".sqliteConnection_read_only_4e7a1c9f3b0d4c25.db";
+        SqliteConnection::Options options;
+        options.readOnly = true;
+        SqliteConnection connection(dbFile.getPath(), options);
+        connection.connect();
+
+        //when we try to write to it
+        const auto actual = connection.performUpdate("create table test (id int);");
+
+        //then we get an error
+        EXPECT_EQ("attempt to write a readonly database", actual.errorText);
+    }
 }
\ No newline at end of file
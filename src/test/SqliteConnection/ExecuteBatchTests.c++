@@ -0,0 +1,157 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::ExecuteBatch
+{
+    const string insertQuery = "insert into test (id, weight, name, data) values (?, ?, ?, ?);";
+
+    SqliteConnection setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, weight real, name varchar(255), data blob);";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+
+        return databasePath.getPath();
+    }
+
+    TEST(executeBatch, will_return_connected_false_if_the_database_is_not_connected)
+    {
+        //given we have a database that we don't connect to
+        const TemporaryFile database = ".sfdb_3e8c1a6f9d2b4f07b5a3e0c8d6f1b294";
+        SqliteConnection connection = setupDatabase(database);
+
+        //when we try to execute a batch
+        const auto actual = connection.executeBatch(insertQuery, {{1, 2.5, "bagel", nullptr}});
+
+        //then we get back a connected value of false
+        const Result<void*> expected = {false, 0, "", {{insertQuery}}, nullptr};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(executeBatch, will_run_the_statement_once_for_every_row_of_parameters)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_a0d7f3c9b1e54a68b2d4f6a8c0e3b517";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we execute a batch of three rows
+        const auto actual = connection.executeBatch(insertQuery,
+        {
+            {1, 2.5, "bagel", nullptr},
+            {2, 3.0, "fork", nullptr},
+            {3, 0.5, "pickle", nullptr}
+        });
+
+        //then all three rows are inserted
+        const Result<void*> expected = {true, 3, "", {{insertQuery}}, nullptr};
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(3, connection.performQuery("select * from test;").data.size());
+    }
+
+    TEST(executeBatch, will_bind_each_parameter_with_its_native_type)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_6f2b9e4d0a7c4e31a8f5c2b9d7e0a463";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we insert an integer, a real, some text and a blob
+        connection.executeBatch(insertQuery, {{1, 2.5, "bagel", Blob{string("\x00\x01", 2)}}});
+
+        //then each value is stored with its own type
+        const auto actual = connection.performQuery(
+            "select typeof(id) as id, typeof(weight) as weight, typeof(name) as name, typeof(data) as data from test;");
+        const QueryReturnData expected = {{{"id", "integer"}, {"weight", "real"}, {"name", "text"}, {"data", "blob"}}};
+        EXPECT_EQ(expected, actual.data);
+    }
+
+    TEST(executeBatch, will_fill_in_null_values_if_a_row_has_too_few_parameters)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_d9a4c7e1f3b04d85a6c0e9b2f5d8a132";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we insert a row with only an id after a full row
+        connection.executeBatch(insertQuery, {{1, 2.5, "bagel", nullptr}, {2}});
+
+        //then the missing values are null instead of the values from the previous row
+        const auto actual = connection.performQuery("select count(*) as total from test where name is null;");
+        EXPECT_EQ("1", actual.data[0].at("total"));
+    }
+
+    TEST(executeBatch, will_roll_back_the_whole_batch_if_a_row_fails)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_1b5e8d2a6c9f4b70a3d1e7c4f0b6a985";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when the second row breaks the primary key
+        const auto actual = connection.executeBatch(insertQuery, {{1}, {1}});
+
+        //then we get an error and nothing is inserted
+        const Result<void*> expected =
+        {
+            true,
+            0,
+            "UNIQUE constraint failed: test.id",
+            {{insertQuery}},
+            nullptr
+        };
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(0, connection.performQuery("select * from test;").data.size());
+    }
+
+    TEST(executeBatch, will_leave_an_open_transaction_for_the_caller_to_finish)
+    {
+        //given we have a database with an open transaction
+        const TemporaryFile database = ".sfdb_8c3f0a9e2d6b4c17b4e8a1f5d3c0b726";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.startTransaction();
+
+        //when we execute a batch then roll back the transaction
+        connection.executeBatch(insertQuery, {{1}, {2}});
+        connection.rollbackTransaction();
+
+        //then the batch was rolled back with the transaction
+        EXPECT_EQ(0, connection.performQuery("select * from test;").data.size());
+    }
+
+    TEST(executeBatch, will_clear_the_statement_cache_when_the_batch_changes_the_structure_of_the_database)
+    {
+        //given we have a connection with a cached statement
+        const TemporaryFile database = ".sfdb_5b9e2d7a0c4f4a18b6d3e1f8a2c7b049";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.performQuery("select * from test;");
+
+        //when we change the structure of the database through a batch
+        const auto actual = connection.executeBatch("alter table test add column dead boolean;", {{}});
+
+        //then the cache was emptied and queries see the new structure
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(0, connection.getStatementCacheStatistics().size);
+        EXPECT_EQ(5, connection.performTableQuery("select * from test;").data.getColumnCount());
+    }
+}
\ No newline at end of file
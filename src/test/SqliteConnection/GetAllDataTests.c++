@@ -117,4 +117,90 @@ namespace StiltFox::StorageShed::Tests::Sqlite_Connection::GetAllData
         };
         EXPECT_EQ(expected, actual);
     }
+
+    TEST(getAllData, will_return_connected_false_with_workers_if_the_datbase_is_not_connected)
+    {
+        //given we have a database that we do not connect to
+        const TemporaryFile database = ".sfdb_a6d2f9c3e0b84a17b5e1d8c4f7a0b362";
+        SqliteConnection connection = setupDatabase(database);
+
+        //when we try to get all data from the database with four workers
+        const auto actual = connection.getAllData(4);
+
+        //then we get back that we are not connected to the database
+        const Result<MultiTableData> expected = {false, 0, "", {}, {}};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(getAllData, will_return_the_same_data_when_read_with_several_workers)
+    {
+        //given we have a database that we are connected to
+        const TemporaryFile database = ".sfdb_e1b7c4a0f8d34c29a2f6e9b5d0c3a784";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we get all the data with four workers
+        const auto actual = connection.getAllData(4);
+
+        //then we get back the same thing as reading the tables one at a time, in the same order
+        EXPECT_EQ(connection.getAllData(), actual);
+    }
+
+    TEST(getAllData, will_read_uncommitted_changes_if_workers_are_requested_during_a_transaction)
+    {
+        //given we have a database with a transaction open that has not been committed
+        const TemporaryFile database = ".sfdb_5f0a8e3d1c7b4f96b3d9a2e6c0f4b817";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.startTransaction();
+        connection.performUpdate("delete from FILEDATA;");
+
+        //when we get all the data with four workers
+        const auto actual = connection.getAllData(4);
+
+        //then we see the data as this connection sees it
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_TRUE(actual.data.at("FILEDATA").empty());
+        connection.rollbackTransaction();
+    }
+
+    TEST(getAllData, will_read_the_tables_on_this_connection_if_another_connection_is_writing)
+    {
+        //given we have a database that we are connected to, and a second connection that wants to write
+        const TemporaryFile database = ".sfdb_c9e4b2d7a0f14e53b8c1f6a3d9e0b275";
+        SqliteConnection connection = setupDatabase(database);
+        SqliteConnection writer = database.getPath();
+        connection.connect();
+        writer.connect();
+        writer.startTransaction();
+        writer.performUpdate("insert into FILEDATA (hashcode, title, trash) values ('xyz', 'scp-173', false);");
+
+        //when we get all the data with four workers while the writer has not committed
+        const auto actual = connection.getAllData(4);
+        writer.commitTransaction();
+
+        //then the workers can not take a snapshot and the tables are read on this connection instead
+        EXPECT_EQ(2, actual.data.at("FILEDATA").size());
+    }
+
+    TEST(getAllData, will_return_the_remaining_columns_if_another_connection_drops_one_from_a_table)
+    {
+        //given we have a database that we read once, and a second connection that drops a column from a table
+        const TemporaryFile database = ".sfdb_2e7a9c4f0b1d4836a5e3c8f1d6b0a492";
+        SqliteConnection connection = setupDatabase(database);
+        sqlite3* other;
+        connection.connect();
+        connection.getAllData();
+        sqlite3_open(database.getPath().c_str(), &other);
+        sqlite3_exec(other, "alter table FILEDATA drop column title;", nullptr, nullptr, nullptr);
+        sqlite3_close(other);
+
+        //when we get all the data again
+        const auto actual = connection.getAllData();
+
+        //then the rows only have the columns that are left
+        const QueryReturnData expected = {{{"hashcode", "abc"}, {"trash", "0"}}, {{"hashcode", "asd"}, {"trash", "1"}}};
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(expected, actual.data.at("FILEDATA"));
+    }
 }
\ No newline at end of file
@@ -110,4 +110,18 @@ namespace StiltFox::StorageShed::Tests::Sqlite_Connection::getMetaData
         };
         EXPECT_EQ(expected, actual);
     }
+
+    TEST(getMetaData, will_return_the_same_metadata_when_read_with_several_workers)
+    {
+        //given we have a database that we are connected to
+        const TemporaryFile database = ".sfdb_3c8e1f5a9d2b4e70b6a4c0f7d9e2a158";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we get the metadata with four workers
+        const auto actual = connection.getMetaData(4);
+
+        //then we get back the same thing as reading the tables one at a time
+        EXPECT_EQ(connection.getMetaData(), actual);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Instrumentation
+{
+    SqliteConnection setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, name varchar(255));"
+                                 "insert into test values (1, 'bagel'), (2, 'fork'), (3, null);";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+
+        return databasePath.getPath();
+    }
+
+    TEST(instrumentation, will_not_fill_in_metrics_or_histograms_while_it_is_turned_off)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_4c1e9b7a2f0d4e63b8a5d3c6f9e2b017";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we run a query without turning instrumentation on
+        const auto actual = connection.performQuery("select * from test;");
+
+        //then no metrics are recorded
+        EXPECT_FALSE(actual.metrics.has_value());
+        EXPECT_TRUE(connection.getLatencyHistograms().empty());
+    }
+
+    TEST(instrumentation, will_count_the_rows_and_bytes_read_by_a_query)
+    {
+        //given we have a database with instrumentation turned on
+        const TemporaryFile database = ".sfdb_a7d2f5c0e8b34a19b6e1c4f7d0a3b852";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.enableInstrumentation();
+
+        //when we run a query
+        const auto actual = connection.performTableQuery("select * from test;");
+
+        //then the metrics count three rows of an integer each, plus the text that is not null
+        ASSERT_TRUE(actual.metrics.has_value());
+        EXPECT_EQ(3, actual.metrics->rows);
+        EXPECT_EQ(3 * 8 + 5 + 4, actual.metrics->bytes);
+        EXPECT_GT(actual.metrics->getTotal().count(), 0);
+    }
+
+    TEST(instrumentation, will_keep_a_histogram_for_each_query_text)
+    {
+        //given we have a database with instrumentation turned on
+        const TemporaryFile database = ".sfdb_e3b8a1d6f4c04b27a9d0e5f2c8b1a674";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.enableInstrumentation();
+
+        //when we run one query three times with different parameters and another query once
+        for (int x=1; x<=3; x++)
+            connection.performQuery(StructuredQuery{"select * from test where id = ?;", {to_string(x)}});
+        connection.performQuery("select count(*) from test;");
+
+        //then each query text has its own histogram
+        const auto actual = connection.getLatencyHistograms();
+        ASSERT_EQ(2, actual.size());
+        EXPECT_EQ(3, actual.at("select * from test where id = ?;").getCount());
+        EXPECT_EQ(1, actual.at("select count(*) from test;").getCount());
+    }
+
+    TEST(instrumentation, will_call_the_slow_query_callback_for_queries_that_take_long_enough)
+    {
+        //given we have a database with a slow query threshold of nothing at all
+        const TemporaryFile database = ".sfdb_1f9c6e3b0a7d4c58a2f4b8e1d5c0a936";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        vector<StructuredQuery> slowQueries;
+        connection.enableInstrumentation(chrono::nanoseconds::zero(),
+            [&slowQueries](const StructuredQuery& query, const QueryMetrics&)
+            {
+                slowQueries.emplace_back(query);
+            });
+
+        //when we run a query
+        connection.performQuery(StructuredQuery{"select * from test where id = ?;", {"2"}});
+
+        //then the callback gets the query along with its parameters
+        const vector<StructuredQuery> expected = {{"select * from test where id = ?;", {"2"}}};
+        EXPECT_EQ(expected, slowQueries);
+    }
+
+    TEST(instrumentation, will_add_up_the_metrics_of_every_table_read_by_getAllData)
+    {
+        //given we have a database with instrumentation turned on
+        const TemporaryFile database = ".sfdb_7b0e4d8a3c6f4d91b5a7e2c0f8d3b145";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.performUpdate("create table other (id int primary key);");
+        connection.performUpdate("insert into other values (1), (2);");
+        connection.enableInstrumentation();
+
+        //when we read all the data
+        const auto actual = connection.getAllData();
+
+        //then the metrics cover the rows from both tables
+        ASSERT_TRUE(actual.metrics.has_value());
+        EXPECT_EQ(5, actual.metrics->rows);
+    }
+
+    TEST(instrumentation, will_stop_recording_when_it_is_turned_off_but_keep_the_histograms)
+    {
+        //given we have a database that has recorded a query
+        const TemporaryFile database = ".sfdb_c5a3f0e7b2d14e86a0c9d6b3f1e8a427";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.enableInstrumentation();
+        connection.performQuery("select * from test;");
+
+        //when we turn instrumentation off and run the query again
+        connection.disableInstrumentation();
+        const auto actual = connection.performQuery("select * from test;");
+
+        //then the second query was not recorded
+        EXPECT_FALSE(actual.metrics.has_value());
+        EXPECT_EQ(1, connection.getLatencyHistograms().at("select * from test;").getCount());
+    }
+
+    TEST(LatencyHistogram, will_estimate_percentiles_to_within_a_bucket)
+    {
+        //given we have a histogram of the latencies 1us through 100us
+        LatencyHistogram histogram;
+        for (int x=1; x<=100; x++) histogram.record(chrono::microseconds(x));
+
+        //when we ask for some percentiles
+        const auto median = histogram.getPercentile(0.5);
+        const auto highest = histogram.getPercentile(1);
+
+        //then the estimates are within a bucket of the real values
+        EXPECT_GE(median, chrono::microseconds(50));
+        EXPECT_LE(median, chrono::microseconds(60));
+        EXPECT_EQ(chrono::microseconds(100), highest);
+        EXPECT_EQ(100, histogram.getCount());
+        EXPECT_EQ(chrono::microseconds(1), histogram.getMinimum());
+    }
+}
\ No newline at end of file
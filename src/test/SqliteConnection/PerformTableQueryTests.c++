@@ -0,0 +1,180 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::PerformTableQuery
+{
+    SqliteConnection setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, weight real, name varchar(255), data blob);"
+                                 "insert into test values (1, 2.5, 'bagel', x'00ff10');"
+                                 "insert into test (id) values (2);";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+
+        return databasePath.getPath();
+    }
+
+    TEST(performTableQuery, will_return_connected_false_if_the_database_is_not_connected)
+    {
+        //given we have a database that we don't connect to
+        const TemporaryFile database = ".sfdb_4a9e2c7b1d3f4e68a0b5c9d2e7f1a346";
+        SqliteConnection connection = setupDatabase(database);
+
+        //when we try to perform a query
+        const auto actual = connection.performTableQuery("select * from test;");
+
+        //then we get back a connected value of false
+        const Result<ResultTable> expected = {false, 0, "", {{"select * from test;"}}, {}};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(performTableQuery, will_return_connected_true_and_an_error_if_the_sql_cannot_be_executed)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_b8d1f6a3c9e24b07a5d2f8e1c4b7a905";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we try to perform a bad query
+        const auto actual = connection.performTableQuery("bad sql");
+
+        //then we get back a connected value of true and an error
+        const Result<ResultTable> expected = {true, 0, "near \"bad\": syntax error", {{"bad sql"}}, {}};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(performTableQuery, will_return_each_value_in_its_native_type)
+    {
+        //given we have a database with a row of every type and a row of nulls
+        const TemporaryFile database = ".sfdb_2e7c0a9f5b1d4c83b6e4a1f9d0c3b758";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we query the table
+        const auto actual = connection.performTableQuery("select * from test order by id;");
+
+        //then each value keeps its type
+        ResultTable expectedData;
+        expectedData.setColumnNames({"id", "weight", "name", "data"});
+        expectedData.appendInteger(1);
+        expectedData.appendReal(2.5);
+        expectedData.appendText("bagel");
+        expectedData.appendBlob(string_view("\x00\xff\x10", 3));
+        expectedData.appendInteger(2);
+        expectedData.appendNull();
+        expectedData.appendNull();
+        expectedData.appendNull();
+        const Result<ResultTable> expected = {true, 0, "", {{"select * from test order by id;"}}, expectedData};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(performTableQuery, will_allow_values_to_be_read_through_a_row_view)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_9f3a6d1c8e0b4f25a7c2e5b8d1f4a063";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we query the table and look at the first row
+        const auto actual = connection.performTableQuery("select * from test order by id;");
+        const ResultTable::RowView row = actual.data[0];
+
+        //then we can read each value by its column
+        EXPECT_EQ(2, actual.data.getRowCount());
+        EXPECT_EQ(1, row.getInteger(actual.data.findColumn("id")));
+        EXPECT_EQ(2.5, row.getReal(actual.data.findColumn("weight")));
+        EXPECT_EQ("bagel", row.getText(actual.data.findColumn("name")));
+        EXPECT_EQ(3, row.getBlob(actual.data.findColumn("data")).size());
+        EXPECT_TRUE(actual.data[1].isNull(1));
+        EXPECT_EQ(4, actual.data.findColumn("missing"));
+    }
+
+    TEST(performTableQuery, will_bind_the_parameters_of_a_StructuredQuery)
+    {
+        //given we have a database and a structured query
+        const TemporaryFile database = ".sfdb_6c0e8b3a2f9d4a71b4e6c9f0a3d2b815";
+        const StructuredQuery structuredQuery = {"select name from test where id = ?;", {"1"}};
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we perform the query
+        const auto actual = connection.performTableQuery(structuredQuery);
+
+        //then we only get back the requested row
+        ResultTable expectedData;
+        expectedData.setColumnNames({"name"});
+        expectedData.appendText("bagel");
+        const Result<ResultTable> expected = {true, 0, "", {structuredQuery}, expectedData};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(performTableQuery, will_convert_to_the_same_data_that_performQuery_returns)
+    {
+        //given we have a database with text, numbers and nulls
+        const TemporaryFile database = ".sfdb_d5b2a8f0e7c14d39a6f3b0e9c2d8a174";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we run the same query through both functions
+        const auto actual = connection.performTableQuery("select id, weight, name from test;");
+        const auto expected = connection.performQuery("select id, weight, name from test;");
+
+        //then the converted table matches the row of maps format
+        EXPECT_EQ(expected.data, actual.data.toQueryReturnData());
+    }
+
+    TEST(performTableQuery, will_return_the_column_names_when_no_rows_are_found)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_1f7c3e9a5b0d4c82a6e4b2d8f0c5a937";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we perform a query that does not match any rows
+        const auto actual = connection.performTableQuery("select id, name from test where id = 3;");
+
+        //then the table has no rows but still has its columns
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(0, actual.data.getRowCount());
+        EXPECT_EQ((vector<string>{"id", "name"}), actual.data.getColumnNames());
+    }
+
+    TEST(performTableQuery, will_return_the_new_columns_if_another_connection_adds_one_to_the_table)
+    {
+        //given we have a database with a cached query, and a second connection that adds a column to the table
+        const TemporaryFile database = ".sfdb_8b3e1f6a2d9c4e07b5a0c7d4f2e9b163";
+        SqliteConnection connection = setupDatabase(database);
+        sqlite3* other;
+        connection.connect();
+        connection.performTableQuery("select * from test;");
+        sqlite3_open(database.getPath().c_str(), &other);
+        sqlite3_exec(other, "alter table test add column color varchar(255);", nullptr, nullptr, nullptr);
+        sqlite3_close(other);
+
+        //when we run the cached query again
+        const auto actual = connection.performTableQuery("select * from test;");
+
+        //then the column names match the rows that were read
+        EXPECT_EQ("", actual.errorText);
+        EXPECT_EQ(2, actual.data.getRowCount());
+        EXPECT_EQ((vector<string>{"id", "weight", "name", "data", "color"}), actual.data.getColumnNames());
+    }
+}
\ No newline at end of file
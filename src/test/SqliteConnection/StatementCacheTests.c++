@@ -0,0 +1,156 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Statement_Cache
+{
+    SqliteConnection setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, value varchar(255));"
+                                 "insert into test (id, value) values (1, 'bagel'), (2, 'fork'), (3, 'pickle');";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+
+        return databasePath.getPath();
+    }
+
+    TEST(statementCache, will_count_a_miss_the_first_time_a_query_is_run_and_a_hit_after_that)
+    {
+        //given we have a database that we connect to
+        const TemporaryFile database = ".sfdb_5d0b7c1e9a2f4c68b3e1d4f7a9c20b61";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+
+        //when we run the same query three times
+        for (int x=0; x<3; x++) connection.performQuery("select * from test;");
+
+        //then we get one miss and two hits
+        const StatementCacheStatistics expected = {2, 1, 0, 1, 64};
+        EXPECT_EQ(expected, connection.getStatementCacheStatistics());
+    }
+
+    TEST(statementCache, will_rebind_parameters_when_a_cached_statement_is_reused)
+    {
+        //given we have a database and a parameterized query that has already been run
+        const TemporaryFile database = ".sfdb_0e6a2d94c7b34f1f8a5e2b9d3c6f7a18";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.performQuery(StructuredQuery{"select value from test where id = ?;", {"1"}});
+
+        //when we run the same query with a different parameter
+        const auto actual = connection.performQuery(StructuredQuery{"select value from test where id = ?;", {"3"}});
+
+        //then we get back the row for the new parameter
+        const Result<QueryReturnData> expected =
+        {
+            true,
+            0,
+            "",
+            {{"select value from test where id = ?;", {"3"}}},
+            {{{"value", "pickle"}}}
+        };
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(statementCache, will_not_keep_parameters_from_a_previous_run_of_a_cached_statement)
+    {
+        //given we have a database and a parameterized insert that has already been run
+        const TemporaryFile database = ".sfdb_9c4f1b7e2d6a4803b5e8f0a1c3d7e924";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.performUpdate(StructuredQuery{"insert into test (id, value) values (?, ?);", {"4", "cucumber"}});
+
+        //when we run the insert again without the second parameter
+        connection.performUpdate(StructuredQuery{"insert into test (id, value) values (?, ?);", {"5"}});
+
+        //then the missing parameter is null rather than the old value
+        const auto actual = connection.performQuery("select count(*) as total from test where value is null;");
+        EXPECT_EQ("1", actual.data[0].at("total"));
+    }
+
+    TEST(statementCache, will_evict_the_least_recently_used_statement_when_full)
+    {
+        //given we have a connection with room for two statements
+        const TemporaryFile database = ".sfdb_7b2e9d1f4a6c4e35b8d0f2a5c9e1b346";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.setStatementCacheSize(2);
+
+        //when we run three different queries, then run the first one again
+        connection.performQuery("select * from test where id = 1;");
+        connection.performQuery("select * from test where id = 2;");
+        connection.performQuery("select * from test where id = 3;");
+        connection.performQuery("select * from test where id = 1;");
+
+        //then the first query had been evicted and has to be prepared again
+        const StatementCacheStatistics expected = {0, 4, 2, 2, 2};
+        EXPECT_EQ(expected, connection.getStatementCacheStatistics());
+    }
+
+    TEST(statementCache, will_be_cleared_when_the_connection_is_disconnected)
+    {
+        //given we have a connection with a cached statement
+        const TemporaryFile database = ".sfdb_2f8a6c0d3e9b4a71b5d4e7f1a0c8b952";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.performQuery("select * from test;");
+
+        //when we disconnect
+        connection.disconnect();
+
+        //then the cache is empty
+        EXPECT_EQ(0, connection.getStatementCacheStatistics().size);
+    }
+
+    TEST(statementCache, will_be_cleared_when_the_structure_of_the_database_changes)
+    {
+        //given we have a connection with a cached statement
+        const TemporaryFile database = ".sfdb_c1e7a3f9b5d24068a2f6e0b8d4c9a713";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.performQuery("select * from test;");
+
+        //when we change the structure of the database
+        connection.performUpdate("alter table test add column dead boolean;");
+        const auto actual = connection.performQuery("select * from test where id = 1;");
+
+        //then the cache was emptied and queries see the new structure
+        EXPECT_EQ(1, connection.getStatementCacheStatistics().size);
+        EXPECT_EQ(3, actual.data[0].size());
+    }
+
+    TEST(statementCache, will_not_cache_anything_if_the_size_is_set_to_zero)
+    {
+        //given we have a connection with the cache disabled
+        const TemporaryFile database = ".sfdb_e4b9d2a7c6f14835a0e3b1d5f8c2a690";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        connection.setStatementCacheSize(0);
+
+        //when we run the same query twice
+        connection.performQuery("select * from test;");
+        const auto actual = connection.performQuery("select * from test;");
+
+        //then nothing is cached and the query still works
+        const StatementCacheStatistics expected = {0, 0, 0, 0, 0};
+        EXPECT_EQ(expected, connection.getStatementCacheStatistics());
+        EXPECT_EQ(3, actual.data.size());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+/*******************************************************
+* Created by Cryos on 10/17/26.
+* Copyright 2026 Stilt Fox® LLC
+*
+* See LICENSE on root project directory for terms
+* of use.
+********************************************************/
+#include <sqlite3.h>
+#include <gtest/gtest.h>
+#include <Stilt_Fox/Scribe/TempFile.h++>
+#include "PrintHelper.h++"
+#include "SqliteConnection.h++"
+
+using namespace std;
+using namespace StiltFox::Scribe;
+using namespace StiltFox::StorageShed;
+using namespace StiltFox::StorageShed::Data;
+
+namespace StiltFox::StorageShed::Tests::Sqlite_Connection::StreamQuery
+{
+    SqliteConnection setupDatabase(const File& databasePath)
+    {
+        sqlite3* connection;
+        const string tableInfo = "create table test (id int primary key, name varchar(255));"
+                                 "create table empty (id int primary key);"
+                                 "insert into test values (1, 'bagel'), (2, 'fork'), (3, 'pickle');";
+
+        sqlite3_open(databasePath.getPath().c_str(), &connection);
+        sqlite3_exec(connection, tableInfo.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(connection);
+
+        return databasePath.getPath();
+    }
+
+    TEST(streamQuery, will_return_connected_false_and_not_visit_anything_if_the_database_is_not_connected)
+    {
+        //given we have a database that we don't connect to
+        const TemporaryFile database = ".sfdb_8b3e1f7a0c5d4e29b6a4d2f8c1e9b053";
+        SqliteConnection connection = setupDatabase(database);
+        int visited = 0;
+
+        //when we try to stream a query
+        const auto actual = connection.streamQuery({"select * from test;", {}}, [&visited](const auto&)
+        {
+            visited++;
+            return true;
+        });
+
+        //then we get back a connected value of false and no rows
+        const Result<void*> expected = {false, 0, "", {{"select * from test;"}}, nullptr};
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(0, visited);
+    }
+
+    TEST(streamQuery, will_visit_every_row_in_order)
+    {
+        //given we have a database with some data
+        const TemporaryFile database = ".sfdb_1d6a9c4e2b8f4a07a3e5c0b7d9f2e168";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        vector<string> names;
+
+        //when we stream a query
+        const auto actual = connection.streamQuery({"select name from test where id > ? order by id;", {"1"}},
+            [&names](const ResultTable::RowView& row)
+            {
+                names.emplace_back(row.getText(0));
+                return true;
+            });
+
+        //then each row was visited
+        const Result<void*> expected =
+        {
+            true,
+            0,
+            "",
+            {{"select name from test where id > ? order by id;", {"1"}}},
+            nullptr
+        };
+        const vector<string> expectedNames = {"fork", "pickle"};
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(expectedNames, names);
+    }
+
+    TEST(streamQuery, will_stop_reading_rows_when_the_visitor_returns_false)
+    {
+        //given we have a database with some data
+        const TemporaryFile database = ".sfdb_f0c7b2e9a4d14836b1f8e3a6c0d5b972";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        int visited = 0;
+
+        //when we stop after the first row
+        const auto actual = connection.streamQuery({"select * from test;", {}}, [&visited](const auto&)
+        {
+            visited++;
+            return false;
+        });
+
+        //then only one row was read and no error is reported
+        EXPECT_EQ(1, visited);
+        EXPECT_EQ("", actual.errorText);
+    }
+
+    TEST(streamAllData, will_hand_every_table_to_the_sink_including_empty_ones)
+    {
+        //given we have a database with a full table and an empty table
+        const TemporaryFile database = ".sfdb_5a2d8f1b7e0c4c93a8d6b4e2f1a7c039";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        unordered_map<string, size_t> rowCounts;
+
+        //when we stream all the data
+        const auto actual = connection.streamAllData([&rowCounts](const string& table, const ResultTable& rows)
+        {
+            rowCounts[table] += rows.getRowCount();
+            return true;
+        });
+
+        //then every table was handed over along with the queries used to read them
+        const Result<void*> expected =
+        {
+            true,
+            0,
+            "",
+            {
+                {"select tbl_name from sqlite_schema where type = 'table';"},
+                {"select * from test;"},
+                {"select * from empty;"}
+            },
+            nullptr
+        };
+        const unordered_map<string, size_t> expectedCounts = {{"test", 3}, {"empty", 0}};
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(expectedCounts, rowCounts);
+    }
+
+    TEST(streamAllData, will_split_tables_into_batches_no_larger_than_the_batch_size)
+    {
+        //given we have a table with three rows
+        const TemporaryFile database = ".sfdb_c3f9e0a6d2b14f58a7e1c8b5d0f3a246";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        vector<size_t> batches;
+
+        //when we stream the data with a batch size of two
+        connection.streamAllData([&batches](const string& table, const ResultTable& rows)
+        {
+            if (table == "test") batches.emplace_back(rows.getRowCount());
+            return true;
+        }, 2);
+
+        //then the rows were split into a batch of two and a batch of one
+        const vector<size_t> expected = {2, 1};
+        EXPECT_EQ(expected, batches);
+    }
+
+    TEST(streamAllData, will_stop_when_the_sink_returns_false)
+    {
+        //given we have a database with two tables
+        const TemporaryFile database = ".sfdb_7e4b0d9c1a3f4b62a5c8f7e0d2b9a418";
+        SqliteConnection connection = setupDatabase(database);
+        connection.connect();
+        int calls = 0;
+
+        //when the sink asks to stop after the first call
+        connection.streamAllData([&calls](const string&, const ResultTable&)
+        {
+            calls++;
+            return false;
+        });
+
+        //then the sink is not called again
+        EXPECT_EQ(1, calls);
+    }
+}
\ No newline at end of file
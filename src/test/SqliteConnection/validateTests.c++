@@ -325,4 +325,92 @@ namespace StiltFox::StorageShed::Tests::Sqlite_Connection::Validate
         const unordered_set<string> expected = {"Database not connected .sfdb_4f92050777cd4f13acde2c3f2e1007eb"};
         EXPECT_EQ(expected, actual);
     }
+
+    TEST(validate, will_see_changes_made_to_the_structure_by_another_connection_after_the_last_validation)
+    {
+        //given we have a database that has already been validated
+        const TemporaryFile database = ".sfdb_6b0d3f8a2e5c4b17a9d1e7c4f0a2b583";
+        SqliteConnection connection = setupDatabase(database.getPath());
+        connection.connect();
+        const TableDefinitions expectedStructure = {{"company", {{"name", "varchar(20)"}, {"city", "varchar(10)"}}}};
+        connection.validate(expectedStructure, false);
+
+        //when another connection drops a column and we validate again
+        sqlite3* otherConnection;
+        sqlite3_open(database.getPath().c_str(), &otherConnection);
+        sqlite3_exec(otherConnection, "alter table company drop column city;", nullptr, nullptr, nullptr);
+        sqlite3_close(otherConnection);
+        const auto actual = connection.validate(expectedStructure, false);
+
+        //then the missing column is found
+        const unordered_set<string> expected = {"Missing column in company: city"};
+        EXPECT_EQ(expected, actual);
+    }
+
+    TEST(validate, will_not_reuse_a_structure_read_inside_a_transaction_that_was_rolled_back)
+    {
+        //given we have validated the database inside a transaction that changed its structure, then rolled it back
+        const TemporaryFile database = ".sfdb_0a7e3c9f5b2d4e61a4c8f1b6d9e2a350";
+        SqliteConnection connection = setupDatabase(database.getPath());
+        connection.connect();
+        connection.startTransaction();
+        connection.performUpdate("create table rolled_back (id int);");
+        connection.validate({}, true);
+        connection.rollbackTransaction();
+
+        //when another connection makes a different change, bringing the schema version back up to the same number
+        sqlite3* otherConnection;
+        sqlite3_open(database.getPath().c_str(), &otherConnection);
+        sqlite3_exec(otherConnection, "create table committed (id int);", nullptr, nullptr, nullptr);
+        sqlite3_close(otherConnection);
+        const auto actual = connection.validate(connection.getMetaData().data, true);
+
+        //then the structure is read again and matches the database
+        EXPECT_EQ(unordered_set<string>{}, actual);
+    }
+
+    TEST(validate, will_not_reuse_a_structure_read_inside_a_transaction_that_was_rolled_back_with_sql)
+    {
+        //given we have validated the database inside a transaction that changed its structure, then rolled it back
+        //by running the sql ourselves
+        const TemporaryFile database = ".sfdb_6d2f8a0c4e1b4973b5a7e9c3f0d1b842";
+        SqliteConnection connection = setupDatabase(database.getPath());
+        connection.connect();
+        connection.performUpdate("begin;");
+        connection.performUpdate("create table rolled_back (id int);");
+        connection.validate({}, true);
+        connection.performUpdate("rollback;");
+
+        //when another connection makes a different change, bringing the schema version back up to the same number
+        sqlite3* otherConnection;
+        sqlite3_open(database.getPath().c_str(), &otherConnection);
+        sqlite3_exec(otherConnection, "create table committed (id int);", nullptr, nullptr, nullptr);
+        sqlite3_close(otherConnection);
+        const auto actual = connection.validate(connection.getMetaData().data, true);
+
+        //then the structure is read again and matches the database
+        EXPECT_EQ(unordered_set<string>{}, actual);
+    }
+
+    TEST(validate, will_only_read_the_structure_of_the_database_again_after_it_changes)
+    {
+        //given we have a database with instrumentation turned on
+        const TemporaryFile database = ".sfdb_e2a7c5d0f9b34e68b1c4a8f3d6e0b927";
+        SqliteConnection connection = setupDatabase(database.getPath());
+        connection.connect();
+        connection.enableInstrumentation();
+        const string getAllColumns = "select tables.tbl_name, columns.name, columns.type from sqlite_schema as tables "
+                                     "join pragma_table_info(tables.tbl_name) as columns where tables.type = 'table';";
+
+        //when we validate three times, with a new table created before the last one
+        connection.validate({}, false);
+        connection.validate({}, false);
+        connection.performUpdate("create table other (id int);");
+        const auto actual = connection.validate({{"other", {{"id", "INT"}}}}, false);
+
+        //then the structure was only read twice, and the new table was seen
+        EXPECT_EQ(2, connection.getLatencyHistograms().at(getAllColumns).getCount());
+        EXPECT_EQ(3, connection.getLatencyHistograms().at("pragma schema_version;").getCount());
+        EXPECT_TRUE(actual.empty());
+    }
 }
\ No newline at end of file
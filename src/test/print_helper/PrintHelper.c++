@@ -58,4 +58,23 @@ namespace StiltFox::StorageShed::Data
         *outputStream << outputText.dump(4) << endl;
     }
 
+    void PrintTo(const Result<ResultTable>& result, std::ostream* outputStream)
+    {
+        json outputText = resultToJsonGeneric(result);
+        outputText["columns"] = result.data.getColumnNames();
+        outputText["data"] = result.data.toQueryReturnData();
+        *outputStream << outputText.dump(4) << endl;
+    }
+
+    void PrintTo(const StatementCacheStatistics& statistics, std::ostream* outputStream)
+    {
+        json outputText;
+        outputText["hits"] = statistics.hits;
+        outputText["misses"] = statistics.misses;
+        outputText["evictions"] = statistics.evictions;
+        outputText["size"] = statistics.size;
+        outputText["capacity"] = statistics.capacity;
+        *outputStream << outputText.dump(4) << endl;
+    }
+
 }
\ No newline at end of file
@@ -15,6 +15,8 @@ namespace StiltFox::StorageShed::Data
     void PrintTo(const Result<TableDefinitions>& result, std::ostream* outputStream);
     void PrintTo(const Result<QueryReturnData>& result, std::ostream* outputStream);
     void PrintTo(const Result<MultiTableData>& result, std::ostream* outputStream);
+    void PrintTo(const Result<ResultTable>& result, std::ostream* outputStream);
+    void PrintTo(const StatementCacheStatistics& statistics, std::ostream* outputStream);
 }
 
 #endif
\ No newline at end of file